@@ -20,12 +20,23 @@ EXPERIMENTS = {
     "dbg": {
     },
     "off": {
+        "backup_poller_test": [
+            "event_engine_client_no_backup_poller",
+        ],
         "census_test": [
             "transport_supplies_client_latency",
         ],
+        "context_list_test": [
+            "tcp_rpc_latency_breakdown",
+        ],
         "core_end2end_test": [
+            "call_arena_pooling",
             "promise_based_client_call",
             "promise_based_server_call",
+            "promise_based_unary_fast_path",
+        ],
+        "cq_test": [
+            "sharded_completion_queue",
         ],
         "endpoint_test": [
             "tcp_frame_size_tuning",
@@ -37,6 +48,9 @@ EXPERIMENTS = {
         "event_engine_listener_test": [
             "event_engine_listener",
         ],
+        "event_engine_poller_test": [
+            "event_engine_batched_epoll_registration",
+        ],
         "flow_control_test": [
             "peer_state_based_framing",
             "tcp_frame_size_tuning",
@@ -45,6 +59,9 @@ EXPERIMENTS = {
         "lame_client_test": [
             "promise_based_client_call",
         ],
+        "lb_unit_test": [
+            "wrr_batched_scheduler",
+        ],
         "resource_quota_test": [
             "free_large_allocator",
             "memory_pressure_controller",
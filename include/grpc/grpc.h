@@ -124,6 +124,22 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but once an event is available also
+    returns up to max_events - 1 further events that are already queued,
+    without polling again. The completion queue must have been created with
+    completion type GRPC_CQ_NEXT, and max_events must be positive.
+
+    Writes the events to \a events and returns the number written (at least
+    1). When the first event is a GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN
+    event it is the only one returned.
+
+    The same restrictions as for grpc_completion_queue_next apply. */
+GRPCAPI int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                             grpc_event* events,
+                                             int max_events,
+                                             gpr_timespec deadline,
+                                             void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
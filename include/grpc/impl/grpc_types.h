@@ -144,6 +144,22 @@ typedef struct {
 /** If non-zero, call metric recording is enabled. */
 #define GRPC_ARG_SERVER_CALL_METRIC_RECORDING \
   "grpc.server_call_metric_recording"
+/** If non-zero, the C++ callback API runs reactions of server callback
+    reactors directly on the thread that completed the underlying operation
+    rather than hopping to an executor thread. Only safe when every reaction
+    of every callback service on the server is non-blocking. */
+#define GRPC_ARG_SERVER_INLINE_CALLBACK_REACTORS \
+  "grpc.server_inline_callback_reactors"
+/** If positive, the polling threads of a C++ sync server hand incoming
+    requests to a separate pool of worker threads through a queue of at most
+    this many requests; requests arriving while the queue is full fail with
+    RESOURCE_EXHAUSTED. Int valued, defaults to 0 (disabled). */
+#define GRPC_ARG_SYNC_SERVER_WORK_QUEUE_SIZE "grpc.sync_server_work_queue_size"
+/** With GRPC_ARG_SYNC_SERVER_WORK_QUEUE_SIZE, the maximum number of worker
+    threads per completion queue of a C++ sync server. Requests are queued
+    only once this many workers are busy. Int valued, defaults to no limit
+    other than the resource quota's thread limit. */
+#define GRPC_ARG_SYNC_SERVER_MAX_WORKERS "grpc.sync_server_max_workers"
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled */
 #define GRPC_ARG_MINIMAL_STACK "grpc.minimal_stack"
@@ -271,12 +287,39 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** If non-zero, a subchannel that has established a connection sends an
+    HTTP/2 ping on it and reports READY only once the ping is acknowledged, so
+    that the first calls on a new connection do not pay for the rest of its
+    setup. Defaults to 0. */
+#define GRPC_ARG_SUBCHANNEL_WARMUP_PING "grpc.subchannel_warmup_ping"
+/** The maximum number of connections a subchannel opens to its address.
+    Connections beyond the first are opened while every existing connection
+    has at least GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION calls in progress,
+    and each call uses the connection with the fewest calls. Defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS "grpc.subchannel_max_connections"
+/** The number of calls in progress on each of a subchannel's connections at
+    which it opens another connection, if allowed by
+    GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS. Usually the server's
+    MAX_CONCURRENT_STREAMS setting. Defaults to 100. */
+#define GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION \
+  "grpc.subchannel_calls_per_connection"
+/** The maximum number of subchannels that the round_robin LB policy connects
+    at the same time. Subchannels beyond the limit wait, in address order, for
+    a running connection attempt to finish. Defaults to 0 (unlimited). */
+#define GRPC_ARG_ROUND_ROBIN_MAX_CONCURRENT_CONNECTS \
+  "grpc.round_robin_max_concurrent_connects"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
+/** The maximum number of incoming connections a server listener handshakes
+    concurrently. Connections accepted beyond the limit wait in a queue until a
+    running handshake finishes; the time spent waiting counts against
+    GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS. Defaults to 0 (unlimited). */
+#define GRPC_ARG_SERVER_MAX_CONCURRENT_HANDSHAKES \
+  "grpc.server_max_concurrent_handshakes"
 /** This *should* be used for testing only.
     The caller of the secure_channel_create functions may override the target
     name used for SSL host name checking using this channel argument which is of
@@ -183,6 +183,45 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
             GOT_EVENT);
   }
 
+  /// EXPERIMENTAL
+  /// Like \a Next, but once an event is available also returns events that
+  /// are already queued, up to \a max_events in total (capped internally at
+  /// 64), without going back to the poller for each one.
+  ///
+  /// \param[out] tags Array of at least \a max_events elements; updated with
+  ///        the tags of the returned events.
+  /// \param[out] oks Array of at least \a max_events elements; updated with
+  ///        the \a ok value of each returned event (see \a Next).
+  /// \param[in] max_events The maximum number of events to return; must be
+  ///        positive.
+  ///
+  /// \return The number of events returned, or 0 if the queue is fully drained
+  ///         and shut down.
+  int NextBatch(void** tags, bool* oks, int max_events) {
+    int num_events = 0;
+    return AsyncNextBatchInternal(tags, oks, max_events,
+                                  gpr_inf_future(GPR_CLOCK_REALTIME),
+                                  &num_events) == GOT_EVENT
+               ? num_events
+               : 0;
+  }
+
+  /// EXPERIMENTAL
+  /// Like \a NextBatch, but blocks only up to \a deadline (or the queue's
+  /// shutdown), like \a AsyncNext.
+  ///
+  /// \param[out] num_events Upon GOT_EVENT, updated with the number of events
+  ///        returned in \a tags and \a oks.
+  ///
+  /// \return The type of event read.
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, int max_events,
+                            const T& deadline, int* num_events) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events,
+                                  deadline_tp.raw_time(), num_events);
+  }
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
@@ -313,6 +352,8 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
   };
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, int max_events,
+                                    gpr_timespec deadline, int* num_events);
 
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
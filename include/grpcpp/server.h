@@ -351,6 +351,10 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   // Whetner per-call load reporting is enabled.
   bool call_metric_recording_enabled_ = false;
 
+  // Whether callback reactor reactions may run inline on the thread that
+  // completed the operation (GRPC_ARG_SERVER_INLINE_CALLBACK_REACTORS).
+  bool inline_callback_reactors_ = false;
+
   // Interface to read or update server-wide metrics. Optional.
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
 };
@@ -292,6 +292,27 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Runs the reactions (OnReadDone, OnWriteDone, OnDone, ...) of callback
+    /// service reactors directly on the thread that completed the underlying
+    /// operation, instead of handing them to an executor thread. This saves a
+    /// thread hop per reaction but is only safe when no reaction of any
+    /// callback service registered on this server ever blocks: a blocking
+    /// reaction stalls the I/O thread that invoked it.
+    void EnableInlineCallbackReactors();
+
+    /// Makes the polling threads of a synchronous server hand incoming RPCs
+    /// to a separate, resizable pool of worker threads through a queue of at
+    /// most \a max_queued_rpcs RPCs, instead of each thread both polling and
+    /// running handlers. MIN_POLLERS then sets the number of polling threads
+    /// and MAX_POLLERS the number of idle workers kept around. RPCs arriving
+    /// while the queue is full fail with RESOURCE_EXHAUSTED.
+    void SetSyncServerWorkQueueSize(int max_queued_rpcs);
+
+    /// With SetSyncServerWorkQueueSize(), caps the worker pool of each
+    /// completion queue at \a max_workers threads. RPCs are queued only once
+    /// that many workers are busy running handlers.
+    void SetSyncServerMaxWorkers(int max_workers);
+
    private:
     ServerBuilder* builder_;
   };
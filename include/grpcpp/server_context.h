@@ -444,6 +444,10 @@ class ServerContextBase {
     message_allocator_state_ = allocator_state;
   }
 
+  // Whether the reactions of this call's callback reactor may be run inline
+  // on the thread that completed the operation.
+  bool inline_reactors() const { return inline_reactors_; }
+
   void MaybeMarkCancelledOnRead() {
     if (grpc_call_failed_before_recv_message(call_.call)) {
       marked_cancelled_.store(true, std::memory_order_release);
@@ -474,6 +478,7 @@ class ServerContextBase {
 
   gpr_timespec deadline_;
   grpc::CompletionQueue* cq_ = nullptr;
+  bool inline_reactors_ = false;
   bool sent_initial_metadata_ = false;
   mutable std::shared_ptr<const grpc::AuthContext> auth_context_;
   mutable grpc::internal::MetadataMap client_metadata_;
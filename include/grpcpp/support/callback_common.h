@@ -82,14 +82,14 @@ class CallbackWithStatusTag : public grpc_completion_queue_functor {
   static void operator delete(void*, void*) { GPR_ASSERT(false); }
 
   CallbackWithStatusTag(grpc_call* call, std::function<void(Status)> f,
-                        CompletionQueueTag* ops)
+                        CompletionQueueTag* ops, bool can_inline = false)
       : call_(call), func_(std::move(f)), ops_(ops) {
     grpc_call_ref(call);
     functor_run = &CallbackWithStatusTag::StaticRun;
-    // A client-side callback should never be run inline since they will always
-    // have work to do from the user application. So, set the parent's
-    // inlineable field to false
-    inlineable = false;
+    // A client-side callback should not be run inline since it will always
+    // have work to do from the user application, unless the application has
+    // promised that work is non-blocking (ClientContext::set_inline_reactors).
+    inlineable = can_inline;
   }
   ~CallbackWithStatusTag() {}
   Status* status_ptr() { return &status_; }
@@ -89,7 +89,8 @@ class CallbackUnaryCallImpl {
         static_cast<OpSetAndTag*>(grpc_call_arena_alloc(call.call(), alloc_sz));
     auto* ops = new (&alloced->opset) FullCallOpSet;
     auto* tag = new (&alloced->tag)
-        grpc::internal::CallbackWithStatusTag(call.call(), on_completion, ops);
+        grpc::internal::CallbackWithStatusTag(call.call(), on_completion, ops,
+                                              context->inline_reactors());
 
     // TODO(vjpai): Unify code with sync API as much as possible
     grpc::Status s = ops->SendMessagePtr(request);
@@ -560,7 +561,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnWritesDoneDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &writes_done_ops_, /*can_inline=*/false);
+        &writes_done_ops_, /*can_inline=*/context_->inline_reactors());
     writes_done_ops_.set_core_cq_tag(&writes_done_tag_);
     callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
     if (GPR_UNLIKELY(corked_write_needed_)) {
@@ -604,7 +605,7 @@ class ClientCallbackReaderWriterImpl
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, /*can_inline=*/context_->inline_reactors());
     start_ops_.RecvInitialMetadata(context_);
     start_ops_.set_core_cq_tag(&start_tag_);
 
@@ -614,7 +615,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnWriteDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &write_ops_, /*can_inline=*/false);
+        &write_ops_, /*can_inline=*/context_->inline_reactors());
     write_ops_.set_core_cq_tag(&write_tag_);
 
     read_tag_.Set(
@@ -623,7 +624,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnReadDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &read_ops_, /*can_inline=*/false);
+        &read_ops_, /*can_inline=*/context_->inline_reactors());
     read_ops_.set_core_cq_tag(&read_tag_);
 
     // Also set up the Finish tag and op set.
@@ -631,7 +632,7 @@ class ClientCallbackReaderWriterImpl
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
         &finish_ops_,
-        /*can_inline=*/false);
+        /*can_inline=*/context_->inline_reactors());
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
   }
@@ -748,7 +749,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, /*can_inline=*/context_->inline_reactors());
     start_ops_.SendInitialMetadata(&context_->send_initial_metadata_,
                                    context_->initial_metadata_flags());
     start_ops_.RecvInitialMetadata(context_);
@@ -762,7 +763,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
           reactor_->OnReadDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &read_ops_, /*can_inline=*/false);
+        &read_ops_, /*can_inline=*/context_->inline_reactors());
     read_ops_.set_core_cq_tag(&read_tag_);
 
     {
@@ -776,7 +777,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
     finish_tag_.Set(
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
-        &finish_ops_, /*can_inline=*/false);
+        &finish_ops_, /*can_inline=*/context_->inline_reactors());
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
     call_.PerformOps(&finish_ops_);
@@ -960,7 +961,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
           reactor_->OnWritesDoneDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &writes_done_ops_, /*can_inline=*/false);
+        &writes_done_ops_, /*can_inline=*/context_->inline_reactors());
     writes_done_ops_.set_core_cq_tag(&writes_done_tag_);
     callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
 
@@ -1007,7 +1008,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, /*can_inline=*/context_->inline_reactors());
     start_ops_.RecvInitialMetadata(context_);
     start_ops_.set_core_cq_tag(&start_tag_);
 
@@ -1017,7 +1018,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
           reactor_->OnWriteDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &write_ops_, /*can_inline=*/false);
+        &write_ops_, /*can_inline=*/context_->inline_reactors());
     write_ops_.set_core_cq_tag(&write_tag_);
 
     // Also set up the Finish tag and op set.
@@ -1027,7 +1028,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
         &finish_ops_,
-        /*can_inline=*/false);
+        /*can_inline=*/context_->inline_reactors());
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
   }
@@ -1134,7 +1135,7 @@ class ClientCallbackUnaryImpl final : public ClientCallbackUnary {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish();
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, /*can_inline=*/context_->inline_reactors());
     start_ops_.SendInitialMetadata(&context_->send_initial_metadata_,
                                    context_->initial_metadata_flags());
     start_ops_.RecvInitialMetadata(context_);
@@ -1143,7 +1144,7 @@ class ClientCallbackUnaryImpl final : public ClientCallbackUnary {
 
     finish_tag_.Set(
         call_.call(), [this](bool /*ok*/) { MaybeFinish(); }, &finish_ops_,
-        /*can_inline=*/false);
+        /*can_inline=*/context_->inline_reactors());
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
     call_.PerformOps(&finish_ops_);
@@ -0,0 +1,181 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_SERVER_UNARY_BATCHER_H
+#define GRPCPP_SUPPORT_SERVER_UNARY_BATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <grpc/support/log.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL: Collects incoming unary RPCs of a single callback method into
+/// batches and hands each batch to one handler invocation.
+///
+/// A batch is dispatched as soon as it holds \a max_batch_size RPCs, or when
+/// \a max_delay has elapsed since its first RPC arrived, whichever comes
+/// first. The handler fills in the response (and optionally the status) of
+/// every RPC in the batch; once it returns, each RPC is finished with its own
+/// status.
+///
+/// Usage, from a generated callback service:
+///
+///   class LookupServiceImpl : public Lookup::CallbackService {
+///     ServerUnaryReactor* Get(CallbackServerContext* context,
+///                             const GetRequest* request,
+///                             GetResponse* response) override {
+///       return batcher_.Add(context, request, response);
+///     }
+///     ServerUnaryBatcher<GetRequest, GetResponse> batcher_{
+///         /*max_batch_size=*/64, std::chrono::microseconds(500),
+///         [](std::vector<ServerUnaryBatcher<GetRequest,
+///                                           GetResponse>::Entry>* batch) {
+///           ...
+///         }};
+///   };
+///
+/// The handler runs either on the thread that added the RPC completing the
+/// batch or on a timer thread, and must not block for long. The batcher must
+/// outlive the server's Shutdown(): Shutdown() waits for pending RPCs, so every
+/// batch has been dispatched by then.
+template <class RequestType, class ResponseType>
+class ServerUnaryBatcher {
+ public:
+  /// One RPC within a batch.
+  struct Entry {
+    grpc::CallbackServerContext* context;
+    const RequestType* request;
+    ResponseType* response;
+    /// The status the RPC is finished with. Defaults to OK.
+    grpc::Status status;
+  };
+
+  using BatchHandler = std::function<void(std::vector<Entry>* batch)>;
+
+  ServerUnaryBatcher(size_t max_batch_size,
+                     std::chrono::system_clock::duration max_delay,
+                     BatchHandler handler)
+      : max_batch_size_(max_batch_size),
+        max_delay_(max_delay),
+        handler_(std::move(handler)) {
+    GPR_ASSERT(max_batch_size_ > 0);
+  }
+
+  ServerUnaryBatcher(const ServerUnaryBatcher&) = delete;
+  ServerUnaryBatcher& operator=(const ServerUnaryBatcher&) = delete;
+
+  ~ServerUnaryBatcher() {
+    grpc::internal::MutexLock lock(&mu_);
+    GPR_ASSERT(current_ == nullptr);
+  }
+
+  /// Queues the RPC for the next batch and returns the reactor that the
+  /// callback method should return.
+  grpc::ServerUnaryReactor* Add(grpc::CallbackServerContext* context,
+                                const RequestType* request,
+                                ResponseType* response) {
+    grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+    Batch* full = nullptr;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (current_ == nullptr) {
+        current_ = new Batch;
+        current_->entries.reserve(max_batch_size_);
+        Batch* batch = current_;
+        current_->alarm.Set(
+            std::chrono::system_clock::now() + max_delay_,
+            [this, batch](bool ok) { OnDelayElapsed(batch, ok); });
+      }
+      current_->entries.push_back(Entry{context, request, response, {}});
+      current_->reactors.push_back(reactor);
+      if (current_->entries.size() >= max_batch_size_) {
+        // If the timer has already claimed the batch, it dispatches it (this
+        // RPC included) as soon as it gets the lock.
+        if (!current_->claimed.exchange(true, std::memory_order_acq_rel)) {
+          full = current_;
+        }
+        current_ = nullptr;
+      }
+    }
+    if (full != nullptr) {
+      full->alarm.Cancel();
+      Dispatch(full);
+      full->Unref();
+    }
+    return reactor;
+  }
+
+ private:
+  struct Batch {
+    std::vector<Entry> entries;
+    std::vector<grpc::ServerUnaryReactor*> reactors;
+    grpc::Alarm alarm;
+    // Set by whichever of the timer and Add() dispatches the batch.
+    std::atomic<bool> claimed{false};
+    // One ref for the timer callback and one for the batch's dispatcher.
+    std::atomic<int> refs{2};
+
+    void Unref() {
+      if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+  };
+
+  void OnDelayElapsed(Batch* batch, bool ok) {
+    // Only touch `this` if the batch is ours to dispatch: its RPCs are then
+    // still pending, which keeps the server, and so the batcher, alive.
+    if (ok && !batch->claimed.exchange(true, std::memory_order_acq_rel)) {
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        if (current_ == batch) current_ = nullptr;
+      }
+      Dispatch(batch);
+      batch->Unref();
+    }
+    batch->Unref();
+  }
+
+  void Dispatch(Batch* batch) {
+    handler_(&batch->entries);
+    for (size_t i = 0; i < batch->entries.size(); ++i) {
+      batch->reactors[i]->Finish(std::move(batch->entries[i].status));
+    }
+  }
+
+  const size_t max_batch_size_;
+  const std::chrono::system_clock::duration max_delay_;
+  const BatchHandler handler_;
+  grpc::internal::Mutex mu_;
+  Batch* current_ ABSL_GUARDED_BY(mu_) = nullptr;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_SERVER_UNARY_BATCHER_H
@@ -28,6 +28,10 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/shim.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/time.h"
@@ -84,6 +88,20 @@ void grpc_client_channel_global_init_backup_polling() {
   }
 }
 
+// Returns true if client channels need the backup poller to make progress
+// while no RPC is polling their pollset_set.
+static bool backup_polling_needed() {
+  // Nothing to do if backup polling is disabled, or if I/O already progresses
+  // in the background. Connections made by the EventEngine client are driven
+  // by the EventEngine's own poller, but other parts of the channel, such as
+  // the c-ares resolver, may still register fds with iomgr, so skipping the
+  // backup poller for them is an experiment.
+  return g_poll_interval != grpc_core::Duration::Zero() &&
+         !grpc_iomgr_run_in_background() &&
+         !(grpc_core::IsEventEngineClientNoBackupPollerEnabled() &&
+           grpc_event_engine::experimental::UseEventEngineClient());
+}
+
 static void backup_poller_shutdown_unref(backup_poller* p) {
   if (gpr_unref(&p->shutdown_refs)) {
     grpc_pollset_destroy(p->pollset);
@@ -130,6 +148,7 @@ static void run_poller(void* arg, grpc_error_handle error) {
     backup_poller_shutdown_unref(p);
     return;
   }
+  grpc_core::global_stats().IncrementClientChannelBackupPolls();
   grpc_error_handle err =
       grpc_pollset_work(p->pollset, nullptr, grpc_core::Timestamp::Now());
   gpr_mu_unlock(p->pollset_mu);
@@ -159,10 +178,7 @@ static void g_poller_init_locked() {
 
 void grpc_client_channel_start_backup_polling(
     grpc_pollset_set* interested_parties) {
-  if (g_poll_interval == grpc_core::Duration::Zero() ||
-      grpc_iomgr_run_in_background()) {
-    return;
-  }
+  if (!backup_polling_needed()) return;
   gpr_mu_lock(&g_poller_mu);
   g_poller_init_locked();
   gpr_ref(&g_poller->refs);
@@ -178,10 +194,7 @@ void grpc_client_channel_start_backup_polling(
 
 void grpc_client_channel_stop_backup_polling(
     grpc_pollset_set* interested_parties) {
-  if (g_poll_interval == grpc_core::Duration::Zero() ||
-      grpc_iomgr_run_in_background()) {
-    return;
-  }
+  if (!backup_polling_needed()) return;
   grpc_pollset_set_del_pollset(interested_parties, g_poller->pollset);
   g_poller_unref();
 }
@@ -30,6 +30,9 @@ GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_client_channel_backup_poll_interval_ms);
 void grpc_client_channel_global_init_backup_polling();
 
 // Starts polling \a interested_parties periodically in the timer thread.
+// This is a no-op when I/O makes progress without it, e.g. when the
+// EventEngine client is in use and the event_engine_client_no_backup_poller
+// experiment is enabled.
 void grpc_client_channel_start_backup_polling(
     grpc_pollset_set* interested_parties);
 
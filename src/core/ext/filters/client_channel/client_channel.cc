@@ -56,6 +56,8 @@
 #include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
 #include "src/core/ext/filters/client_channel/lb_policy/child_policy_handler.h"
 #include "src/core/ext/filters/client_channel/local_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/request_coalescing_filter.h"
+#include "src/core/ext/filters/client_channel/request_coalescing_service_config.h"
 #include "src/core/ext/filters/client_channel/retry_filter.h"
 #include "src/core/ext/filters/client_channel/subchannel.h"
 #include "src/core/ext/filters/client_channel/subchannel_interface_internal.h"
@@ -566,6 +568,10 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
     return subchannel_->connected_subchannel();
   }
 
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelForCall() const {
+    return subchannel_->PickConnectedSubchannelForCall();
+  }
+
   void RequestConnection() override { subchannel_->RequestConnection(); }
 
   void ResetBackoff() override { subchannel_->ResetBackoff(); }
@@ -1477,6 +1483,13 @@ void ClientChannel::UpdateServiceConfigInDataPlaneLocked() {
   // Construct dynamic filter stack.
   std::vector<const grpc_channel_filter*> filters =
       config_selector->GetFilters();
+  // Only pay for the coalescing filter if some method can use it.
+  if (!new_args.WantMinimalStack() && service_config != nullptr &&
+      service_config->GetGlobalParsedConfig(
+          internal::RequestCoalescingServiceConfigParser::ParserIndex()) !=
+          nullptr) {
+    filters.push_back(&kRequestCoalescingFilterVtable);
+  }
   if (enable_retries) {
     filters.push_back(&kRetryFilterVtable);
   } else {
@@ -1584,7 +1597,7 @@ void ClientChannel::UpdateStateAndPickerLocked(
   // Old picker will be unreffed after releasing the lock.
   {
     MutexLock lock(&lb_mu_);
-    picker_.swap(picker);
+    picker = picker_.Set(std::move(picker));
     // Reprocess queued picks.
     for (LoadBalancedCall* call : lb_queued_calls_) {
       call->RemoveCallFromLbQueuedCallsLocked();
@@ -1632,11 +1645,8 @@ grpc_error_handle ClientChannel::DoPingLocked(grpc_transport_op* op) {
   if (state_tracker_.state() != GRPC_CHANNEL_READY) {
     return GRPC_ERROR_CREATE("channel not connected");
   }
-  LoadBalancingPolicy::PickResult result;
-  {
-    MutexLock lock(&lb_mu_);
-    result = picker_->Pick(LoadBalancingPolicy::PickArgs());
-  }
+  LoadBalancingPolicy::PickResult result =
+      picker_.Get()->Pick(LoadBalancingPolicy::PickArgs());
   return HandlePickResult<grpc_error_handle>(
       &result,
       // Complete pick.
@@ -2447,10 +2457,7 @@ ClientChannel::LoadBalancedCall::LbCallState::GetCallAttribute(
     UniqueTypeName type) {
   auto* service_config_call_data = static_cast<ServiceConfigCallData*>(
       lb_call_->call_context()[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
-  auto& call_attributes = service_config_call_data->call_attributes();
-  auto it = call_attributes.find(type);
-  if (it == call_attributes.end()) return absl::string_view();
-  return it->second;
+  return service_config_call_data->call_attributes().Get(type);
 }
 
 //
@@ -2532,6 +2539,8 @@ ClientChannel::LoadBalancedCall::LoadBalancedCall(
 }
 
 ClientChannel::LoadBalancedCall::~LoadBalancedCall() {
+  // The call was counted against its connection when it was picked.
+  if (connected_subchannel_ != nullptr) connected_subchannel_->CallDestroyed();
   if (backend_metric_data_ != nullptr) {
     backend_metric_data_->BackendMetricData::~BackendMetricData();
   }
@@ -2612,15 +2621,8 @@ absl::optional<absl::Status> ClientChannel::LoadBalancedCall::PickSubchannel(
         },
         DEBUG_LOCATION);
   });
-  // Grab mutex and take a ref to the picker.
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-    gpr_log(GPR_INFO, "chand=%p lb_call=%p: grabbing LB mutex to get picker",
-            chand_, this);
-  }
-  {
-    MutexLock lock(&chand_->lb_mu_);
-    pickers.emplace_back(chand_->picker_);
-  }
+  // Take a ref to the picker.  This does not need the LB mutex.
+  pickers.emplace_back(chand_->picker_.Get());
   while (true) {
     // Do pick.
     if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
@@ -2632,13 +2634,16 @@ absl::optional<absl::Status> ClientChannel::LoadBalancedCall::PickSubchannel(
     if (!pick_complete) {
       MutexLock lock(&chand_->lb_mu_);
       // If picker has been swapped out since we grabbed it, try again.
-      if (chand_->picker_ != pickers.back()) {
+      // The picker is only replaced under the LB mutex, so once we hold it
+      // the check cannot race with the queue being reprocessed.
+      auto picker = chand_->picker_.Get();
+      if (picker != pickers.back()) {
         if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
           gpr_log(GPR_INFO,
                   "chand=%p lb_call=%p: pick not complete, but picker changed",
                   chand_, this);
         }
-        pickers.emplace_back(chand_->picker_);
+        pickers.emplace_back(std::move(picker));
         continue;
       }
       // Otherwise queue the pick to try again later when we get a new picker.
@@ -2692,7 +2697,7 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelImpl(
         // holding the data plane mutex.
         SubchannelWrapper* subchannel =
             static_cast<SubchannelWrapper*>(complete_pick->subchannel.get());
-        connected_subchannel_ = subchannel->connected_subchannel();
+        connected_subchannel_ = subchannel->PickConnectedSubchannelForCall();
         // If the subchannel has no connected subchannel (e.g., if the
         // subchannel has moved out of state READY but the LB policy hasn't
         // yet seen that change and given us a new picker), then just
@@ -49,6 +49,7 @@
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/rcu_ref_counted_ptr.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -305,11 +306,12 @@ class ClientChannel {
       ABSL_GUARDED_BY(resolution_mu_);
 
   //
-  // Fields related to LB picks.  Guarded by lb_mu_.
+  // Fields related to LB picks.
   //
   mutable Mutex lb_mu_;
-  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
-      ABSL_GUARDED_BY(lb_mu_);
+  // Read without a lock by LB picks; only replaced while holding lb_mu_, so
+  // that queued picks can check it against the picker they used.
+  RcuRefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
   absl::flat_hash_set<LoadBalancedCall*> lb_queued_calls_
       ABSL_GUARDED_BY(lb_mu_);
 
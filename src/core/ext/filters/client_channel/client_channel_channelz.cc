@@ -20,6 +20,8 @@
 
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 
+#include <vector>
+
 #include "src/core/lib/transport/connectivity_state.h"
 
 // IWYU pragma: no_include <type_traits>
@@ -44,6 +46,16 @@ void SubchannelNode::SetChildSocket(RefCountedPtr<SocketNode> socket) {
   child_socket_ = std::move(socket);
 }
 
+void SubchannelNode::AddPooledChildSocket(RefCountedPtr<SocketNode> socket) {
+  MutexLock lock(&socket_mu_);
+  pooled_child_sockets_.emplace(socket->uuid(), std::move(socket));
+}
+
+void SubchannelNode::RemovePooledChildSocket(intptr_t uuid) {
+  MutexLock lock(&socket_mu_);
+  pooled_child_sockets_.erase(uuid);
+}
+
 Json SubchannelNode::RenderJson() {
   // Create and fill the data child.
   grpc_connectivity_state state =
@@ -71,20 +83,24 @@ Json SubchannelNode::RenderJson() {
        }},
       {"data", std::move(data)},
   };
-  // Populate the child socket.
-  RefCountedPtr<SocketNode> child_socket;
+  // Populate the child sockets.
+  std::vector<RefCountedPtr<SocketNode>> child_sockets;
   {
     MutexLock lock(&socket_mu_);
-    child_socket = child_socket_;
+    if (child_socket_ != nullptr) child_sockets.push_back(child_socket_);
+    for (const auto& p : pooled_child_sockets_) {
+      child_sockets.push_back(p.second);
+    }
   }
-  if (child_socket != nullptr && child_socket->uuid() != 0) {
-    object["socketRef"] = Json::Array{
-        Json::Object{
-            {"socketId", std::to_string(child_socket->uuid())},
-            {"name", child_socket->name()},
-        },
-    };
+  Json::Array socket_refs;
+  for (const auto& child_socket : child_sockets) {
+    if (child_socket->uuid() == 0) continue;
+    socket_refs.emplace_back(Json::Object{
+        {"socketId", std::to_string(child_socket->uuid())},
+        {"name", child_socket->name()},
+    });
   }
+  if (!socket_refs.empty()) object["socketRef"] = std::move(socket_refs);
   return object;
 }
 
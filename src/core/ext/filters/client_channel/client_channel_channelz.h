@@ -22,8 +22,10 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
+#include <map>
 #include <string>
 #include <utility>
 
@@ -54,6 +56,11 @@ class SubchannelNode : public BaseNode {
   // subchannel unrefs the transport.
   void SetChildSocket(RefCountedPtr<SocketNode> socket);
 
+  // Used for the subchannel's connections other than the main one, when it
+  // has more than one.
+  void AddPooledChildSocket(RefCountedPtr<SocketNode> socket);
+  void RemovePooledChildSocket(intptr_t uuid);
+
   Json RenderJson() override;
 
   // proxy methods to composed classes.
@@ -74,6 +81,8 @@ class SubchannelNode : public BaseNode {
   std::atomic<grpc_connectivity_state> connectivity_state_{GRPC_CHANNEL_IDLE};
   Mutex socket_mu_;
   RefCountedPtr<SocketNode> child_socket_ ABSL_GUARDED_BY(socket_mu_);
+  std::map<intptr_t, RefCountedPtr<SocketNode>> pooled_child_sockets_
+      ABSL_GUARDED_BY(socket_mu_);
   std::string target_;
   CallCountingHelper call_counter_;
   ChannelTrace trace_;
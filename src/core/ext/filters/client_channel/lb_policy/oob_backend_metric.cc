@@ -299,6 +299,16 @@ void OrcaProducer::OnConnectivityStateChange(grpc_connectivity_state state) {
   }
 }
 
+void OrcaProducer::OnConnectionLost(
+    const ConnectedSubchannel* connected_subchannel) {
+  MutexLock lock(&mu_);
+  // Only move the stream if it was running on the connection that was lost.
+  if (connected_subchannel_.get() != connected_subchannel) return;
+  connected_subchannel_ = subchannel_->connected_subchannel();
+  stream_client_.reset();
+  if (!watchers_.empty()) MaybeStartStreamLocked();
+}
+
 //
 // OrcaWatcher
 //
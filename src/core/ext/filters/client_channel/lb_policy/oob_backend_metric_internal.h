@@ -63,6 +63,9 @@ class OrcaProducer : public Subchannel::DataProducerInterface {
   void AddWatcher(OrcaWatcher* watcher);
   void RemoveWatcher(OrcaWatcher* watcher);
 
+  void OnConnectionLost(
+      const ConnectedSubchannel* connected_subchannel) override;
+
  private:
   class ConnectivityWatcher;
   class OrcaStreamEventHandler;
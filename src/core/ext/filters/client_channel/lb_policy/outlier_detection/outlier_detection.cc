@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <map>
@@ -32,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/numeric/bits.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -41,12 +43,15 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/child_policy_handler.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/histogram_view.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -75,6 +80,60 @@ using ::grpc_event_engine::experimental::EventEngine;
 constexpr absl::string_view kOutlierDetection =
     "outlier_detection_experimental";
 
+// Histogram of call latencies in microseconds that can be updated from any
+// thread without locking.  Below 4us there is one bucket per microsecond;
+// above that, four buckets per power of two up to 2^30us (about 18 minutes),
+// so each bucket spans at most 25% of its lower bound.
+class LatencyHistogram {
+ public:
+  void Add(int64_t micros) {
+    buckets_[BucketFor(static_cast<int>(
+                 std::min<int64_t>(micros, kMaxLatencyMicros)))]
+        .fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Reset() {
+    for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+  }
+
+  // Returns the given percentile and the number of samples, or nullopt if
+  // there are no samples.
+  absl::optional<std::pair<double, uint64_t>> PercentileAndCount(
+      double percentile) const {
+    uint64_t buckets[kNumBuckets];
+    for (int i = 0; i < kNumBuckets; ++i) {
+      buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    HistogramView view{BucketFor, BucketBoundaries(), kNumBuckets, buckets};
+    const uint64_t count = static_cast<uint64_t>(view.Count());
+    if (count == 0) return absl::nullopt;
+    return {{view.Percentile(percentile), count}};
+  }
+
+ private:
+  static constexpr int64_t kMaxLatencyMicros = (1 << 30) - 1;
+  static constexpr int kNumBuckets = 4 + 4 * 28;
+
+  static int BucketFor(int value) {
+    if (value < 4) return std::max(value, 0);
+    const int msb = absl::bit_width(static_cast<uint32_t>(value)) - 1;
+    return 4 * (msb - 1) + ((value >> (msb - 2)) & 3);
+  }
+
+  static const int* BucketBoundaries() {
+    static const auto* boundaries = []() {
+      auto* boundaries = new std::array<int, kNumBuckets + 1>();
+      for (int i = 0; i <= kNumBuckets; ++i) {
+        (*boundaries)[i] = i < 4 ? i : (4 + i % 4) << (i / 4 - 1);
+      }
+      return boundaries;
+    }();
+    return boundaries->data();
+  }
+
+  std::atomic<uint64_t> buckets_[kNumBuckets]{};
+};
+
 // Config for xDS Cluster Impl LB policy.
 class OutlierDetectionLbConfig : public LoadBalancingPolicy::Config {
  public:
@@ -88,7 +147,12 @@ class OutlierDetectionLbConfig : public LoadBalancingPolicy::Config {
 
   bool CountingEnabled() const {
     return outlier_detection_config_.success_rate_ejection.has_value() ||
-           outlier_detection_config_.failure_percentage_ejection.has_value();
+           outlier_detection_config_.failure_percentage_ejection.has_value() ||
+           LatencyTrackingEnabled();
+  }
+
+  bool LatencyTrackingEnabled() const {
+    return outlier_detection_config_.latency_ejection.has_value();
   }
 
   const OutlierDetectionConfig& outlier_detection_config() const {
@@ -218,11 +282,27 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     struct Bucket {
       std::atomic<uint64_t> successes;
       std::atomic<uint64_t> failures;
+      // Latencies of successful calls. Null unless latency ejection has been
+      // configured.
+      std::unique_ptr<LatencyHistogram> latencies;
     };
 
+    // Allocates the latency histograms. Must be called before any picker
+    // that tracks latency can use this state.
+    void EnableLatencyTracking() {
+      for (Bucket* bucket : {current_bucket_.get(), backup_bucket_.get()}) {
+        if (bucket->latencies == nullptr) {
+          bucket->latencies = std::make_unique<LatencyHistogram>();
+        }
+      }
+    }
+
     void RotateBucket() {
       backup_bucket_->successes = 0;
       backup_bucket_->failures = 0;
+      if (backup_bucket_->latencies != nullptr) {
+        backup_bucket_->latencies->Reset();
+      }
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
     }
@@ -240,6 +320,11 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
           {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
     }
 
+    absl::optional<std::pair<double, uint64_t>> GetP99LatencyAndVolume() {
+      if (backup_bucket_->latencies == nullptr) return absl::nullopt;
+      return backup_bucket_->latencies->PercentileAndCount(99);
+    }
+
     void AddSubchannel(SubchannelWrapper* wrapper) {
       subchannels_.insert(wrapper);
     }
@@ -252,6 +337,11 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
 
     void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
 
+    void AddLatency(int64_t micros) {
+      LatencyHistogram* latencies = active_bucket_.load()->latencies.get();
+      if (latencies != nullptr) latencies->Add(micros);
+    }
+
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
     void Eject(const Timestamp& time) {
@@ -310,7 +400,8 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
   class Picker : public SubchannelPicker {
    public:
     Picker(OutlierDetectionLb* outlier_detection_lb,
-           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled);
+           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled,
+           bool latency_tracking_enabled);
 
     PickResult Pick(PickArgs args) override;
 
@@ -318,6 +409,7 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     class SubchannelCallTracker;
     RefCountedPtr<SubchannelPicker> picker_;
     bool counting_enabled_;
+    bool latency_tracking_enabled_;
   };
 
   class Helper : public ChannelControlHelper {
@@ -433,17 +525,22 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
   SubchannelCallTracker(
       std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
           original_subchannel_call_tracker,
-      RefCountedPtr<SubchannelState> subchannel_state)
+      RefCountedPtr<SubchannelState> subchannel_state, bool track_latency)
       : original_subchannel_call_tracker_(
             std::move(original_subchannel_call_tracker)),
-        subchannel_state_(std::move(subchannel_state)) {}
+        subchannel_state_(std::move(subchannel_state)),
+        track_latency_(track_latency) {}
 
   ~SubchannelCallTracker() override {
     subchannel_state_.reset(DEBUG_LOCATION, "SubchannelCallTracker");
   }
 
   void Start() override {
-    // This tracker does not care about started calls only finished calls.
+    // This tracker only cares about started calls when measuring latency.
+    if (track_latency_) {
+      start_ = gpr_get_cycle_counter();
+      started_ = true;
+    }
     // Delegate if needed.
     if (original_subchannel_call_tracker_ != nullptr) {
       original_subchannel_call_tracker_->Start();
@@ -460,6 +557,12 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
     if (subchannel_state_ != nullptr) {
       if (args.status.ok()) {
         subchannel_state_->AddSuccessCount();
+        if (started_) {
+          gpr_timespec latency =
+              gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_);
+          subchannel_state_->AddLatency(latency.tv_sec * GPR_US_PER_SEC +
+                                        latency.tv_nsec / GPR_NS_PER_US);
+        }
       } else {
         subchannel_state_->AddFailureCount();
       }
@@ -470,6 +573,9 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
   std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
       original_subchannel_call_tracker_;
   RefCountedPtr<SubchannelState> subchannel_state_;
+  const bool track_latency_;
+  bool started_ = false;
+  gpr_cycle_counter start_;
 };
 
 //
@@ -478,8 +584,11 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
 
 OutlierDetectionLb::Picker::Picker(OutlierDetectionLb* outlier_detection_lb,
                                    RefCountedPtr<SubchannelPicker> picker,
-                                   bool counting_enabled)
-    : picker_(std::move(picker)), counting_enabled_(counting_enabled) {
+                                   bool counting_enabled,
+                                   bool latency_tracking_enabled)
+    : picker_(std::move(picker)),
+      counting_enabled_(counting_enabled),
+      latency_tracking_enabled_(latency_tracking_enabled) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
     gpr_log(GPR_INFO,
             "[outlier_detection_lb %p] constructed new picker %p and counting "
@@ -508,7 +617,8 @@ LoadBalancingPolicy::PickResult OutlierDetectionLb::Picker::Pick(
       complete_pick->subchannel_call_tracker =
           std::make_unique<SubchannelCallTracker>(
               std::move(complete_pick->subchannel_call_tracker),
-              subchannel_wrapper->subchannel_state());
+              subchannel_wrapper->subchannel_state(),
+              latency_tracking_enabled_);
     }
     complete_pick->subchannel = subchannel_wrapper->wrapped_subchannel();
   }
@@ -647,6 +757,12 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
       }
     }
   }
+  // Only pay for latency histograms if latency ejection is configured.
+  if (config_->LatencyTrackingEnabled()) {
+    for (const auto& p : subchannel_state_map_) {
+      p.second->EnableLatencyTracking();
+    }
+  }
   // Create child policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(args.args);
@@ -669,7 +785,8 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
 void OutlierDetectionLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
     auto outlier_detection_picker =
-        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled());
+        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled(),
+                               config_->LatencyTrackingEnabled());
     if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
       gpr_log(GPR_INFO,
               "[outlier_detection_lb %p] updating connectivity: state=%s "
@@ -808,6 +925,7 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
   }
   std::map<SubchannelState*, double> success_rate_ejection_candidates;
   std::map<SubchannelState*, double> failure_percentage_ejection_candidates;
+  std::map<SubchannelState*, double> latency_ejection_candidates;
   size_t ejected_host_count = 0;
   double success_rate_sum = 0;
   auto time_now = Timestamp::Now();
@@ -841,15 +959,27 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
         failure_percentage_ejection_candidates[subchannel_state] = success_rate;
       }
     }
+    if (config.latency_ejection.has_value()) {
+      absl::optional<std::pair<double, uint64_t>> host_p99_latency_and_volume =
+          subchannel_state->GetP99LatencyAndVolume();
+      if (host_p99_latency_and_volume.has_value() &&
+          host_p99_latency_and_volume->second >=
+              config.latency_ejection->request_volume) {
+        latency_ejection_candidates[subchannel_state] =
+            host_p99_latency_and_volume->first;
+      }
+    }
   }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
     gpr_log(GPR_INFO,
             "[outlier_detection_lb %p] found %" PRIuPTR
             " success rate candidates and %" PRIuPTR
-            " failure percentage candidates; ejected_host_count=%" PRIuPTR
+            " failure percentage candidates and %" PRIuPTR
+            " latency candidates; ejected_host_count=%" PRIuPTR
             "; success_rate_sum=%.3f",
             parent_.get(), success_rate_ejection_candidates.size(),
-            failure_percentage_ejection_candidates.size(), ejected_host_count,
+            failure_percentage_ejection_candidates.size(),
+            latency_ejection_candidates.size(), ejected_host_count,
             success_rate_sum);
   }
   // success rate algorithm
@@ -958,6 +1088,67 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       }
     }
   }
+  // latency algorithm
+  if (!latency_ejection_candidates.empty() &&
+      latency_ejection_candidates.size() >=
+          config.latency_ejection->minimum_hosts) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+      gpr_log(GPR_INFO, "[outlier_detection_lb %p] running latency algorithm",
+              parent_.get());
+    }
+    // calculate ejection threshold: (median p99 latency *
+    // (latency_ejection.threshold / 100))
+    std::vector<double> p99_latencies;
+    p99_latencies.reserve(latency_ejection_candidates.size());
+    for (const auto& p : latency_ejection_candidates) {
+      p99_latencies.push_back(p.second);
+    }
+    auto median = p99_latencies.begin() + p99_latencies.size() / 2;
+    std::nth_element(p99_latencies.begin(), median, p99_latencies.end());
+    const double ejection_threshold =
+        *median * config.latency_ejection->threshold / 100;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+      gpr_log(GPR_INFO,
+              "[outlier_detection_lb %p] median_p99_latency=%.3fus, "
+              "ejection_threshold=%.3fus",
+              parent_.get(), *median, ejection_threshold);
+    }
+    for (auto& candidate : latency_ejection_candidates) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+        gpr_log(GPR_INFO,
+                "[outlier_detection_lb %p] checking candidate %p: "
+                "p99_latency=%.3fus",
+                parent_.get(), candidate.first, candidate.second);
+      }
+      // Extra check to make sure the other algorithms didn't already eject
+      // this backend.
+      if (candidate.first->ejection_time().has_value()) continue;
+      if (candidate.second > ejection_threshold) {
+        uint32_t random_key = absl::Uniform(bit_gen_, 1, 100);
+        double current_percent =
+            100.0 * ejected_host_count / parent_->subchannel_state_map_.size();
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+          gpr_log(GPR_INFO,
+                  "[outlier_detection_lb %p] random_key=%d "
+                  "ejected_host_count=%" PRIuPTR " current_percent=%.3f",
+                  parent_.get(), random_key, ejected_host_count,
+                  current_percent);
+        }
+        if (random_key < config.latency_ejection->enforcement_percentage &&
+            (ejected_host_count == 0 ||
+             (current_percent < config.max_ejection_percent))) {
+          // Eject and record the timestamp for use when ejecting addresses in
+          // this iteration.
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+            gpr_log(GPR_INFO, "[outlier_detection_lb %p] ejecting candidate",
+                    parent_.get());
+          }
+          candidate.first->Eject(time_now);
+          ++ejected_host_count;
+        }
+      }
+    }
+  }
   // For each address in the map:
   //   If the address is not ejected and the multiplier is greater than 0,
   //   decrease the multiplier by 1. If the address is ejected, and the
@@ -1087,6 +1278,31 @@ void OutlierDetectionConfig::FailurePercentageEjection::JsonPostLoad(
   }
 }
 
+const JsonLoaderInterface* OutlierDetectionConfig::LatencyEjection::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<LatencyEjection>()
+          .OptionalField("threshold", &LatencyEjection::threshold)
+          .OptionalField("enforcementPercentage",
+                         &LatencyEjection::enforcement_percentage)
+          .OptionalField("minimumHosts", &LatencyEjection::minimum_hosts)
+          .OptionalField("requestVolume", &LatencyEjection::request_volume)
+          .Finish();
+  return loader;
+}
+
+void OutlierDetectionConfig::LatencyEjection::JsonPostLoad(
+    const Json&, const JsonArgs&, ValidationErrors* errors) {
+  if (enforcement_percentage > 100) {
+    ValidationErrors::ScopedField field(errors, ".enforcement_percentage");
+    errors->AddError("value must be <= 100");
+  }
+  if (threshold <= 100) {
+    ValidationErrors::ScopedField field(errors, ".threshold");
+    errors->AddError("value must be > 100");
+  }
+}
+
 const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
   static const auto* loader =
       JsonObjectLoader<OutlierDetectionConfig>()
@@ -1101,6 +1317,8 @@ const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
                          &OutlierDetectionConfig::success_rate_ejection)
           .OptionalField("failurePercentageEjection",
                          &OutlierDetectionConfig::failure_percentage_ejection)
+          .OptionalField("latencyEjection",
+                         &OutlierDetectionConfig::latency_ejection)
           .Finish();
   return loader;
 }
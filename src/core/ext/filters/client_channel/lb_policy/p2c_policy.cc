@@ -0,0 +1,591 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/p2c_policy.h"
+
+#include <inttypes.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/load_balancing/subchannel_interface.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+
+namespace grpc_core {
+
+// Data for a particular subchannel in a subchannel list.
+// This subclass adds the following functionality:
+// - Tracks the previous connectivity state of the subchannel, so that
+//   we know how many subchannels are in each state.
+// - Holds the stats for the subchannel's address.
+class P2cPolicy::P2cSubchannelData
+    : public SubchannelData<P2cSubchannelList, P2cSubchannelData> {
+ public:
+  P2cSubchannelData(
+      SubchannelList<P2cSubchannelList, P2cSubchannelData>* subchannel_list,
+      const ServerAddress& address, RefCountedPtr<SubchannelInterface> sc);
+
+  absl::optional<grpc_connectivity_state> connectivity_state() const {
+    return logical_connectivity_state_;
+  }
+
+  RefCountedPtr<EndpointStats> stats() const { return stats_; }
+
+ private:
+  // Performs connectivity state updates that need to be done only
+  // after we have started watching.
+  void ProcessConnectivityChangeLocked(
+      absl::optional<grpc_connectivity_state> old_state,
+      grpc_connectivity_state new_state) override;
+
+  // Updates the logical connectivity state.
+  void UpdateLogicalConnectivityStateLocked(
+      grpc_connectivity_state connectivity_state);
+
+  // The logical connectivity state of the subchannel.
+  // Note that the logical connectivity state may differ from the
+  // actual reported state in some cases (e.g., after we see
+  // TRANSIENT_FAILURE, we ignore any subsequent state changes until
+  // we see READY).
+  absl::optional<grpc_connectivity_state> logical_connectivity_state_;
+
+  RefCountedPtr<EndpointStats> stats_;
+};
+
+// A list of subchannels.
+class P2cPolicy::P2cSubchannelList
+    : public SubchannelList<P2cSubchannelList, P2cSubchannelData> {
+ public:
+  P2cSubchannelList(P2cPolicy* policy, ServerAddressList addresses,
+                    const ChannelArgs& args)
+      : SubchannelList(policy,
+                       (GRPC_TRACE_FLAG_ENABLED(*policy->tracer_)
+                            ? policy->log_prefix_
+                            : nullptr),
+                       std::move(addresses), policy->channel_control_helper(),
+                       args) {
+    // Need to maintain a ref to the LB policy as long as we maintain
+    // any references to subchannels, since the subchannels'
+    // pollset_sets will include the LB policy's pollset_set.
+    policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+  }
+
+  ~P2cSubchannelList() override {
+    P2cPolicy* p = static_cast<P2cPolicy*>(policy());
+    p->Unref(DEBUG_LOCATION, "subchannel_list");
+  }
+
+  // Updates the counters of subchannels in each state when a
+  // subchannel transitions from old_state to new_state.
+  void UpdateStateCountersLocked(
+      absl::optional<grpc_connectivity_state> old_state,
+      grpc_connectivity_state new_state);
+
+  // Ensures that the right subchannel list is used and then updates
+  // the aggregated connectivity state based on the subchannel list's
+  // state counters.
+  void MaybeUpdateAggregatedConnectivityStateLocked(
+      absl::Status status_for_tf);
+
+ private:
+  std::string CountersString() const {
+    return absl::StrCat("num_subchannels=", num_subchannels(),
+                        " num_ready=", num_ready_,
+                        " num_connecting=", num_connecting_,
+                        " num_transient_failure=", num_transient_failure_);
+  }
+
+  size_t num_ready_ = 0;
+  size_t num_connecting_ = 0;
+  size_t num_transient_failure_ = 0;
+
+  absl::Status last_failure_;
+};
+
+class P2cPolicy::Picker : public SubchannelPicker {
+ public:
+  Picker(P2cPolicy* parent, P2cSubchannelList* subchannel_list);
+
+  PickResult Pick(PickArgs args) override;
+
+ private:
+  // Tracks each call as in flight until it finishes and reports its
+  // round-trip time to the endpoint's stats.
+  class SubchannelCallTracker : public SubchannelCallTrackerInterface {
+   public:
+    SubchannelCallTracker(RefCountedPtr<EndpointStats> stats,
+                          RefCountedPtr<Config> config)
+        : stats_(std::move(stats)), config_(std::move(config)) {}
+
+    void Start() override;
+    void Finish(FinishArgs args) override;
+
+   private:
+    RefCountedPtr<EndpointStats> stats_;
+    RefCountedPtr<Config> config_;
+    gpr_cycle_counter start_;
+  };
+
+  struct SubchannelInfo {
+    RefCountedPtr<SubchannelInterface> subchannel;
+    RefCountedPtr<EndpointStats> stats;
+  };
+
+  // Returns a random number. Safe to call from any number of threads.
+  uint64_t NextRandom();
+
+  // Using pointer value only, no ref held -- do not dereference!
+  P2cPolicy* parent_;
+
+  TraceFlag* const tracer_;
+  const char* const log_prefix_;
+  const RefCountedPtr<Config> config_;
+  const bool distinct_pair_;
+  const size_t choice_count_;
+  std::vector<SubchannelInfo> subchannels_;
+  std::atomic<uint64_t> random_state_;
+};
+
+//
+// P2cPolicy::EndpointStats
+//
+
+P2cPolicy::EndpointStats::~EndpointStats() {
+  MutexLock lock(&policy_->endpoint_stats_map_mu_);
+  auto it = policy_->endpoint_stats_map_.find(key_);
+  if (it != policy_->endpoint_stats_map_.end() && it->second == this) {
+    policy_->endpoint_stats_map_.erase(it);
+  }
+}
+
+//
+// P2cPolicy::Picker::SubchannelCallTracker
+//
+
+void P2cPolicy::Picker::SubchannelCallTracker::Start() {
+  stats_->CallStarted();
+  start_ = gpr_get_cycle_counter();
+}
+
+void P2cPolicy::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  gpr_timespec rtt = gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_);
+  stats_->CallFinished(*config_, rtt.tv_sec * 1e6 + rtt.tv_nsec / 1e3,
+                       args.status);
+}
+
+//
+// P2cPolicy::Picker
+//
+
+P2cPolicy::Picker::Picker(P2cPolicy* parent, P2cSubchannelList* subchannel_list)
+    : parent_(parent),
+      tracer_(parent->tracer_),
+      log_prefix_(parent->log_prefix_),
+      config_(parent->config_),
+      distinct_pair_(parent->PickDistinctPair()),
+      choice_count_(distinct_pair_ ? 2 : parent->ChoiceCount()),
+      random_state_(absl::Uniform<uint64_t>(parent->bit_gen_)) {
+  for (size_t i = 0; i < subchannel_list->num_subchannels(); ++i) {
+    P2cSubchannelData* sd = subchannel_list->subchannel(i);
+    if (sd->connectivity_state() == GRPC_CHANNEL_READY) {
+      subchannels_.push_back({sd->subchannel()->Ref(), sd->stats()});
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+    gpr_log(GPR_INFO,
+            "[%s %p picker %p] created picker from subchannel_list=%p "
+            "with %" PRIuPTR " READY subchannels",
+            log_prefix_, parent_, this, subchannel_list, subchannels_.size());
+  }
+}
+
+uint64_t P2cPolicy::Picker::NextRandom() {
+  // splitmix64.
+  uint64_t z = random_state_.fetch_add(0x9e3779b97f4a7c15,
+                                       std::memory_order_relaxed) +
+               0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+P2cPolicy::PickResult P2cPolicy::Picker::Pick(PickArgs /*args*/) {
+  const Timestamp now = Timestamp::Now();
+  size_t index = 0;
+  double cost = 0;
+  auto consider = [&](size_t i, size_t candidate) {
+    const double candidate_cost =
+        subchannels_[candidate].stats->Cost(*config_, now);
+    if (i == 0 || candidate_cost < cost) {
+      index = candidate;
+      cost = candidate_cost;
+    }
+  };
+  if (choice_count_ >= subchannels_.size()) {
+    // Sampling would see every subchannel anyway, so compare them all,
+    // starting at a random one so that ties are broken randomly.
+    const size_t start = NextRandom() % subchannels_.size();
+    for (size_t i = 0; i < subchannels_.size(); ++i) {
+      consider(i, (start + i) % subchannels_.size());
+    }
+  } else if (distinct_pair_) {
+    // Pick two distinct subchannels at random and use the cheaper one.
+    const uint64_t random = NextRandom();
+    const size_t first = (random & 0xffffffff) % subchannels_.size();
+    const size_t second =
+        (first + 1 + (random >> 32) % (subchannels_.size() - 1)) %
+        subchannels_.size();
+    consider(0, first);
+    consider(1, second);
+  } else {
+    // Sample choice_count_ subchannels at random (with replacement, as in
+    // the xDS least_request policy) and use the cheapest one.
+    for (size_t i = 0; i < choice_count_; ++i) {
+      consider(i, NextRandom() % subchannels_.size());
+    }
+  }
+  const SubchannelInfo& subchannel_info = subchannels_[index];
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+    gpr_log(GPR_INFO,
+            "[%s %p picker %p] returning index %" PRIuPTR
+            ", subchannel=%p, cost=%f",
+            log_prefix_, parent_, this, index,
+            subchannel_info.subchannel.get(), cost);
+  }
+  return PickResult::Complete(subchannel_info.subchannel,
+                              std::make_unique<SubchannelCallTracker>(
+                                  subchannel_info.stats, config_));
+}
+
+//
+// P2cPolicy
+//
+
+P2cPolicy::P2cPolicy(Args args, TraceFlag* tracer, const char* log_prefix)
+    : LoadBalancingPolicy(std::move(args)),
+      tracer_(tracer),
+      log_prefix_(log_prefix) {
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+    gpr_log(GPR_INFO, "[%s %p] Created", log_prefix_, this);
+  }
+}
+
+P2cPolicy::~P2cPolicy() {
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+    gpr_log(GPR_INFO, "[%s %p] Destroying policy", log_prefix_, this);
+  }
+  GPR_ASSERT(subchannel_list_ == nullptr);
+  GPR_ASSERT(latest_pending_subchannel_list_ == nullptr);
+}
+
+void P2cPolicy::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+    gpr_log(GPR_INFO, "[%s %p] Shutting down", log_prefix_, this);
+  }
+  shutdown_ = true;
+  subchannel_list_.reset();
+  latest_pending_subchannel_list_.reset();
+}
+
+void P2cPolicy::ResetBackoffLocked() {
+  subchannel_list_->ResetBackoffLocked();
+  if (latest_pending_subchannel_list_ != nullptr) {
+    latest_pending_subchannel_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status P2cPolicy::UpdateLocked(UpdateArgs args) {
+  config_ = std::move(args.config);
+  ServerAddressList addresses;
+  if (args.addresses.ok()) {
+    if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+      gpr_log(GPR_INFO, "[%s %p] received update with %" PRIuPTR " addresses",
+              log_prefix_, this, args.addresses->size());
+    }
+    addresses = std::move(*args.addresses);
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+      gpr_log(GPR_INFO, "[%s %p] received update with address error: %s",
+              log_prefix_, this, args.addresses.status().ToString().c_str());
+    }
+    // If we already have a subchannel list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (subchannel_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new subchannel list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(*tracer_) &&
+      latest_pending_subchannel_list_ != nullptr) {
+    gpr_log(GPR_INFO, "[%s %p] replacing previous pending subchannel list %p",
+            log_prefix_, this, latest_pending_subchannel_list_.get());
+  }
+  latest_pending_subchannel_list_ =
+      MakeRefCounted<P2cSubchannelList>(this, std::move(addresses), args.args);
+  latest_pending_subchannel_list_->StartWatchingLocked();
+  // If the new list is empty, immediately promote it to
+  // subchannel_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_subchannel_list_->num_subchannels() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(*tracer_) && subchannel_list_ != nullptr) {
+      gpr_log(GPR_INFO, "[%s %p] replacing previous subchannel list %p",
+              log_prefix_, this, subchannel_list_.get());
+    }
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    absl::Status status =
+        args.addresses.ok() ? absl::UnavailableError(absl::StrCat(
+                                  "empty address list: ", args.resolution_note))
+                            : args.addresses.status();
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        MakeRefCounted<TransientFailurePicker>(status));
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // subchannel_list_ and report CONNECTING.
+  if (subchannel_list_.get() == nullptr) {
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker")));
+  }
+  return absl::OkStatus();
+}
+
+RefCountedPtr<P2cPolicy::EndpointStats> P2cPolicy::GetOrCreateStats(
+    const grpc_resolved_address& address) {
+  auto key = grpc_sockaddr_to_uri(&address);
+  if (!key.ok()) key = "";
+  MutexLock lock(&endpoint_stats_map_mu_);
+  auto it = endpoint_stats_map_.find(*key);
+  if (it != endpoint_stats_map_.end()) {
+    auto stats = it->second->RefIfNonZero();
+    if (stats != nullptr) return stats;
+  }
+  auto stats = CreateEndpointStats(*key);
+  endpoint_stats_map_[*key] = stats.get();
+  return stats;
+}
+
+
+//
+// P2cPolicy::P2cSubchannelList
+//
+
+void P2cPolicy::P2cSubchannelList::UpdateStateCountersLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  if (old_state.has_value()) {
+    GPR_ASSERT(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      GPR_ASSERT(num_ready_ > 0);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING) {
+      GPR_ASSERT(num_connecting_ > 0);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      GPR_ASSERT(num_transient_failure_ > 0);
+      --num_transient_failure_;
+    }
+  }
+  GPR_ASSERT(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void P2cPolicy::P2cSubchannelList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  P2cPolicy* p = static_cast<P2cPolicy*>(policy());
+  // If this is latest_pending_subchannel_list_, then swap it into
+  // subchannel_list_ in the following cases:
+  // - subchannel_list_ has no READY subchannels.
+  // - This list has at least one READY subchannel and we have seen the
+  //   initial connectivity state notification for all subchannels.
+  // - All of the subchannels in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (p->latest_pending_subchannel_list_.get() == this &&
+      (p->subchannel_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllSubchannelsSeenInitialState()) ||
+       num_transient_failure_ == num_subchannels())) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      const std::string old_counters_string =
+          p->subchannel_list_ != nullptr ? p->subchannel_list_->CountersString()
+                                         : "";
+      gpr_log(GPR_INFO,
+              "[%s %p] swapping out subchannel list %p (%s) in favor "
+              "of %p (%s)",
+              p->log_prefix_, p, p->subchannel_list_.get(),
+              old_counters_string.c_str(), this, CountersString().c_str());
+    }
+    p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
+  }
+  // Only set connectivity state if this is the current subchannel list.
+  if (p->subchannel_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY subchannel is READY => policy is READY.
+  // 2) ANY subchannel is CONNECTING => policy is CONNECTING.
+  // 3) ALL subchannels are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO, "[%s %p] reporting READY with subchannel list %p",
+              p->log_prefix_, p, this);
+    }
+    p->channel_control_helper()->UpdateState(GRPC_CHANNEL_READY, absl::Status(),
+                                             MakeRefCounted<Picker>(p, this));
+  } else if (num_connecting_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO,
+              "[%s %p] reporting CONNECTING with subchannel list %p",
+              p->log_prefix_, p, this);
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(p->Ref(DEBUG_LOCATION, "QueuePicker")));
+  } else if (num_transient_failure_ == num_subchannels()) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO,
+              "[%s %p] reporting TRANSIENT_FAILURE with subchannel "
+              "list %p: %s",
+              p->log_prefix_, p, this, status_for_tf.ToString().c_str());
+    }
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.ToString()));
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, last_failure_,
+        MakeRefCounted<TransientFailurePicker>(last_failure_));
+  }
+}
+
+//
+// P2cPolicy::P2cSubchannelData
+//
+
+P2cPolicy::P2cSubchannelData::P2cSubchannelData(
+    SubchannelList<P2cSubchannelList, P2cSubchannelData>* subchannel_list,
+    const ServerAddress& address, RefCountedPtr<SubchannelInterface> sc)
+    : SubchannelData(subchannel_list, address, std::move(sc)),
+      stats_(static_cast<P2cPolicy*>(subchannel_list->policy())
+                 ->GetOrCreateStats(address.address())) {}
+
+void P2cPolicy::P2cSubchannelData::ProcessConnectivityChangeLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  P2cPolicy* p = static_cast<P2cPolicy*>(subchannel_list()->policy());
+  GPR_ASSERT(subchannel() != nullptr);
+  // If this is not the initial state notification and the new state is
+  // TRANSIENT_FAILURE or IDLE, re-resolve.
+  // Note that we don't want to do this on the initial state notification,
+  // because that would result in an endless loop of re-resolution.
+  if (old_state.has_value() && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+                                new_state == GRPC_CHANNEL_IDLE)) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO,
+              "[%s %p] Subchannel %p reported %s; requesting "
+              "re-resolution",
+              p->log_prefix_, p, subchannel(),
+              ConnectivityStateName(new_state));
+    }
+    p->channel_control_helper()->RequestReresolution();
+  }
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO,
+              "[%s %p] Subchannel %p reported IDLE; requesting "
+              "connection",
+              p->log_prefix_, p, subchannel());
+    }
+    subchannel()->RequestConnection();
+  }
+  // Update logical connectivity state.
+  UpdateLogicalConnectivityStateLocked(new_state);
+  // Update the policy state.
+  subchannel_list()->MaybeUpdateAggregatedConnectivityStateLocked(
+      connectivity_status());
+}
+
+void P2cPolicy::P2cSubchannelData::UpdateLogicalConnectivityStateLocked(
+    grpc_connectivity_state connectivity_state) {
+  P2cPolicy* p = static_cast<P2cPolicy*>(subchannel_list()->policy());
+  if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+    gpr_log(
+        GPR_INFO,
+        "[%s %p] connectivity changed for subchannel %p, "
+        "subchannel_list %p (index %" PRIuPTR " of %" PRIuPTR
+        "): prev_state=%s new_state=%s",
+        p->log_prefix_, p, subchannel(), subchannel_list(), Index(),
+        subchannel_list()->num_subchannels(),
+        (logical_connectivity_state_.has_value()
+             ? ConnectivityStateName(*logical_connectivity_state_)
+             : "N/A"),
+        ConnectivityStateName(connectivity_state));
+  }
+  // Decide what state to report for aggregation purposes.
+  // If the last logical state was TRANSIENT_FAILURE, then ignore the
+  // state change unless the new state is READY.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+      connectivity_state != GRPC_CHANNEL_READY) {
+    return;
+  }
+  // If the new state is IDLE, treat it as CONNECTING, since it will
+  // immediately transition into CONNECTING anyway.
+  if (connectivity_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->tracer_)) {
+      gpr_log(GPR_INFO,
+              "[%s %p] subchannel %p, subchannel_list %p "
+              "(index %" PRIuPTR " of %" PRIuPTR "): treating IDLE as "
+              "CONNECTING",
+              p->log_prefix_, p, subchannel(), subchannel_list(), Index(),
+              subchannel_list()->num_subchannels());
+    }
+    connectivity_state = GRPC_CHANNEL_CONNECTING;
+  }
+  // If no change, return false.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == connectivity_state) {
+    return;
+  }
+  // Otherwise, update counters and logical state.
+  subchannel_list()->UpdateStateCountersLocked(logical_connectivity_state_,
+                                               connectivity_state);
+  logical_connectivity_state_ = connectivity_state;
+}
+
+
+}  // namespace grpc_core
@@ -0,0 +1,159 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_P2C_POLICY_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_P2C_POLICY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+
+namespace grpc_core {
+
+// Base class for LB policies that pick among READY endpoints by comparing a
+// few random ones with a per-endpoint cost ("power of two choices").
+//
+// The base class owns the subchannel list, connectivity state aggregation
+// and the picker. Each pick samples ChoiceCount() endpoints, or a pair of
+// distinct ones, and uses the one whose EndpointStats::Cost() is lowest; the
+// call tracker returned with the pick counts the call as in flight and
+// reports its round-trip time back to the endpoint's stats when it finishes.
+// Picks take no locks.
+//
+// Subclasses provide name(), CreateEndpointStats() and, optionally,
+// ChoiceCount() or PickDistinctPair(), and may subclass EndpointStats to
+// track more than the number of calls in flight.
+class P2cPolicy : public LoadBalancingPolicy {
+ public:
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ protected:
+  // Load data for a given address. Shared by all subchannel lists and
+  // pickers that use the address, so that it survives address list updates.
+  class EndpointStats : public RefCounted<EndpointStats> {
+   public:
+    EndpointStats(RefCountedPtr<P2cPolicy> policy, std::string key)
+        : policy_(std::move(policy)), key_(std::move(key)) {}
+    ~EndpointStats() override;
+
+    void CallStarted() { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+    void CallFinished(const Config& config, double rtt_micros,
+                      const absl::Status& status) {
+      in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      RecordCall(config, rtt_micros, status);
+    }
+
+    int64_t in_flight() const {
+      return in_flight_.load(std::memory_order_relaxed);
+    }
+
+    // Returns the cost of sending one more call to the endpoint.  By
+    // default, this is the number of calls in flight.
+    virtual double Cost(const Config& /*config*/, Timestamp /*now*/) const {
+      return in_flight();
+    }
+
+   protected:
+    P2cPolicy* policy() const { return policy_.get(); }
+    const std::string& key() const { return key_; }
+
+   private:
+    // Called for each finished call, after it is no longer in flight.
+    virtual void RecordCall(const Config& /*config*/, double /*rtt_micros*/,
+                            const absl::Status& /*status*/) {}
+
+    RefCountedPtr<P2cPolicy> policy_;
+    const std::string key_;
+    std::atomic<int64_t> in_flight_{0};
+  };
+
+  // tracer must outlive the policy; log_prefix is used in trace logs.
+  P2cPolicy(Args args, TraceFlag* tracer, const char* log_prefix);
+  ~P2cPolicy() override;
+
+  // Returns the number of endpoints compared by each pick. Called under the
+  // work serializer when a picker is created.
+  virtual size_t ChoiceCount() const { return 2; }
+
+  // Returns true if each pick should compare two distinct endpoints instead
+  // of ChoiceCount() endpoints sampled with replacement (as in the xDS
+  // least_request policy). Called under the work serializer when a picker is
+  // created.
+  virtual bool PickDistinctPair() const { return false; }
+
+  // Creates the stats for a new address.
+  virtual RefCountedPtr<EndpointStats> CreateEndpointStats(std::string key) = 0;
+
+  // The config from the latest update.
+  const Config* config() const { return config_.get(); }
+
+  TraceFlag* tracer() const { return tracer_; }
+  const char* log_prefix() const { return log_prefix_; }
+
+ private:
+  class P2cSubchannelData;
+  class P2cSubchannelList;
+  class Picker;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<EndpointStats> GetOrCreateStats(
+      const grpc_resolved_address& address);
+
+  TraceFlag* const tracer_;
+  const char* const log_prefix_;
+
+  RefCountedPtr<Config> config_;
+
+  // List of subchannels.
+  RefCountedPtr<P2cSubchannelList> subchannel_list_;
+  // Latest pending subchannel list.
+  // When we get an updated address list, we create a new subchannel list
+  // for it here, and we wait to swap it into subchannel_list_ until the new
+  // list becomes READY.
+  RefCountedPtr<P2cSubchannelList> latest_pending_subchannel_list_;
+
+  Mutex endpoint_stats_map_mu_;
+  std::map<std::string, EndpointStats*, std::less<>> endpoint_stats_map_
+      ABSL_GUARDED_BY(&endpoint_stats_map_mu_);
+
+  bool shutdown_ = false;
+
+  absl::BitGen bit_gen_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_P2C_POLICY_H
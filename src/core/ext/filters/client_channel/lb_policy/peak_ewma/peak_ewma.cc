@@ -0,0 +1,232 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/p2c_policy.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_factory.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_lb_peak_ewma_trace(false, "peak_ewma_lb");
+
+namespace {
+
+constexpr absl::string_view kPeakEwma = "peak_ewma_experimental";
+
+// Cost of an endpoint that has calls in flight but has not completed any
+// yet, so that new endpoints get probed by one call at a time.
+constexpr double kPenaltyMicros = 1e9;
+
+// A call that fails is recorded as a sample this many times the larger of
+// its own RTT, the endpoint's current average and kMinFailureMicros, so that
+// an endpoint that fails fast does not look like the fastest one.
+constexpr double kFailurePenaltyFactor = 2;
+constexpr double kMinFailureMicros = 1e4;
+
+// Config for peak_ewma policy.
+class PeakEwmaConfig : public LoadBalancingPolicy::Config {
+ public:
+  PeakEwmaConfig() = default;
+
+  PeakEwmaConfig(const PeakEwmaConfig&) = delete;
+  PeakEwmaConfig& operator=(const PeakEwmaConfig&) = delete;
+
+  PeakEwmaConfig(PeakEwmaConfig&&) = delete;
+  PeakEwmaConfig& operator=(PeakEwmaConfig&&) = delete;
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  Duration decay_time() const { return decay_time_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<PeakEwmaConfig>()
+            .OptionalField("decayTime", &PeakEwmaConfig::decay_time_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (decay_time_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".decayTime");
+      errors->AddError("must be greater than 0");
+    }
+  }
+
+ private:
+  Duration decay_time_ = Duration::Seconds(10);
+};
+
+// Peak-EWMA LB policy.
+//
+// Each endpoint's latency is tracked with an exponentially weighted moving
+// average of call round-trip times that jumps straight up to any sample above
+// it, so that a degraded endpoint is penalized immediately but only
+// rehabilitated gradually. Picks use power of two choices: two random READY
+// endpoints are compared by average latency times (in-flight calls + 1).
+// Failed calls are recorded as slow ones.
+class PeakEwma : public P2cPolicy {
+ public:
+  explicit PeakEwma(Args args)
+      : P2cPolicy(std::move(args), &grpc_lb_peak_ewma_trace, "PEAK_EWMA") {}
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+ private:
+  class PeakEwmaStats : public EndpointStats {
+   public:
+    using EndpointStats::EndpointStats;
+
+    double Cost(const Config& config, Timestamp now) const override;
+
+   private:
+    void RecordCall(const Config& config, double rtt_micros,
+                    const absl::Status& status) override;
+
+    // Updated by completing calls with a CAS loop and read by pickers.  The
+    // two fields are not updated together, so a picker may briefly see a new
+    // timestamp with the previous average, which only affects the decay.
+    std::atomic<double> ewma_micros_{0};  // 0 until the first call completes.
+    std::atomic<int64_t> last_update_millis_{0};
+  };
+
+  bool PickDistinctPair() const override { return true; }
+
+  RefCountedPtr<EndpointStats> CreateEndpointStats(std::string key) override {
+    return MakeRefCounted<PeakEwmaStats>(Ref(DEBUG_LOCATION, "EndpointStats"),
+                                         std::move(key));
+  }
+};
+
+//
+// PeakEwma::PeakEwmaStats
+//
+
+void PeakEwma::PeakEwmaStats::RecordCall(const Config& config,
+                                         double rtt_micros,
+                                         const absl::Status& status) {
+  const Duration decay_time =
+      static_cast<const PeakEwmaConfig&>(config).decay_time();
+  const bool failed = !status.ok();
+  const Timestamp now = Timestamp::Now();
+  // Each completion decays the average by the time since the previous one.
+  const Duration elapsed =
+      now - Timestamp::FromMillisecondsAfterProcessEpoch(
+                last_update_millis_.exchange(
+                    now.milliseconds_after_process_epoch(),
+                    std::memory_order_relaxed));
+  const double weight = std::exp(
+      -std::max(elapsed, Duration::Zero()).seconds() / decay_time.seconds());
+  double ewma = ewma_micros_.load(std::memory_order_relaxed);
+  double sample;
+  double new_ewma;
+  do {
+    sample = failed ? std::min(std::max({rtt_micros, ewma, kMinFailureMicros}) *
+                                   kFailurePenaltyFactor,
+                               kPenaltyMicros)
+                    : rtt_micros;
+    // Jump to the peak, otherwise decay towards the sample.
+    new_ewma = ewma == 0 || sample > ewma
+                   ? sample
+                   : ewma * weight + sample * (1 - weight);
+  } while (!ewma_micros_.compare_exchange_weak(ewma, new_ewma,
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed));
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_peak_ewma_trace)) {
+    gpr_log(GPR_INFO,
+            "[PEAK_EWMA %p] endpoint %s: rtt=%fus failed=%d sample=%fus "
+            "ewma=%fus",
+            policy(), key().c_str(), rtt_micros, failed, sample, new_ewma);
+  }
+}
+
+double PeakEwma::PeakEwmaStats::Cost(const Config& config,
+                                     Timestamp now) const {
+  const Duration decay_time =
+      static_cast<const PeakEwmaConfig&>(config).decay_time();
+  const int64_t in_flight = this->in_flight();
+  const double ewma = ewma_micros_.load(std::memory_order_relaxed);
+  if (ewma == 0) return in_flight == 0 ? 0 : kPenaltyMicros + in_flight;
+  // Without new samples the average decays, so that an endpoint that was
+  // once slow eventually gets traffic again.
+  const Duration elapsed =
+      now - Timestamp::FromMillisecondsAfterProcessEpoch(
+                last_update_millis_.load(std::memory_order_relaxed));
+  const double decayed =
+      ewma * std::exp(-std::max(elapsed, Duration::Zero()).seconds() /
+                      decay_time.seconds());
+  return decayed * (in_flight + 1);
+}
+
+//
+// factory
+//
+
+class PeakEwmaFactory : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<PeakEwma>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    if (json.type() == Json::Type::JSON_NULL) {
+      // The policy was mentioned in the deprecated loadBalancingPolicy
+      // field or in the client API, so use the defaults.
+      return MakeRefCounted<PeakEwmaConfig>();
+    }
+    return LoadRefCountedFromJson<PeakEwmaConfig>(
+        json, JsonArgs(), "errors validating peak_ewma LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<PeakEwmaFactory>());
+}
+
+}  // namespace grpc_core
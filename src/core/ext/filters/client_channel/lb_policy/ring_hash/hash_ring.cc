@@ -0,0 +1,87 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/hash_ring.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+HashRing::HashRing(std::vector<uint64_t> hashes,
+                   std::vector<uint32_t> subchannel_indexes)
+    : hashes_(std::move(hashes)),
+      subchannel_indexes_(std::move(subchannel_indexes)) {
+  GPR_ASSERT(hashes_.size() == subchannel_indexes_.size());
+  // Sort the entries by sorting a permutation of their indexes, then
+  // applying it to both arrays in place, one cycle at a time.
+  std::vector<uint32_t> order(hashes_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [this](uint32_t lhs, uint32_t rhs) {
+    return hashes_[lhs] < hashes_[rhs];
+  });
+  for (size_t i = 0; i < order.size(); ++i) {
+    const uint64_t hash = hashes_[i];
+    const uint32_t subchannel_index = subchannel_indexes_[i];
+    size_t dest = i;
+    while (order[dest] != i) {
+      const size_t src = order[dest];
+      hashes_[dest] = hashes_[src];
+      subchannel_indexes_[dest] = subchannel_indexes_[src];
+      order[dest] = dest;
+      dest = src;
+    }
+    hashes_[dest] = hash;
+    subchannel_indexes_[dest] = subchannel_index;
+    order[dest] = dest;
+  }
+  // Use about one bucket per 8 entries, so that the table is small and a
+  // bucket usually spans a single cache line of hashes.
+  int bucket_bits = 1;
+  while (bucket_bits < 32 && (size_t{8} << bucket_bits) <= hashes_.size()) {
+    ++bucket_bits;
+  }
+  bucket_shift_ = 64 - bucket_bits;
+  const size_t num_buckets = size_t{1} << bucket_bits;
+  bucket_starts_.resize(num_buckets + 1);
+  size_t index = 0;
+  for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+    while (index < hashes_.size() &&
+           (hashes_[index] >> bucket_shift_) < bucket) {
+      ++index;
+    }
+    bucket_starts_[bucket] = index;
+  }
+  bucket_starts_[num_buckets] = hashes_.size();
+}
+
+size_t HashRing::FindEntry(uint64_t hash) const {
+  const size_t bucket = hash >> bucket_shift_;
+  // Entries in later buckets all have larger hashes, so if there is no match
+  // in this bucket, the answer is the first entry of the next one.
+  auto it = std::lower_bound(hashes_.begin() + bucket_starts_[bucket],
+                             hashes_.begin() + bucket_starts_[bucket + 1],
+                             hash);
+  const size_t index = it - hashes_.begin();
+  return index == hashes_.size() ? 0 : index;
+}
+
+}  // namespace grpc_core
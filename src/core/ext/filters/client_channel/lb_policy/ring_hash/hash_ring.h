@@ -0,0 +1,65 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_HASH_RING_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_HASH_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace grpc_core {
+
+// The entries of a hash ring, each a hash and the index of the subchannel it
+// maps to. They are stored as two parallel arrays sorted by hash, so that the
+// search only touches the hashes and each entry takes 12 bytes instead of 16.
+// A table indexed by the top bits of the hash narrows the search down to a
+// few neighbouring entries.
+class HashRing {
+ public:
+  HashRing() = default;
+
+  // Takes the entries in any order; the two vectors must have the same size.
+  HashRing(std::vector<uint64_t> hashes,
+           std::vector<uint32_t> subchannel_indexes);
+
+  size_t size() const { return hashes_.size(); }
+
+  uint64_t hash(size_t index) const { return hashes_[index]; }
+
+  size_t subchannel_index(size_t index) const {
+    return subchannel_indexes_[index];
+  }
+
+  // Returns the index of the first entry whose hash is not less than hash,
+  // wrapping around to the first entry. Must not be called on an empty ring.
+  size_t FindEntry(uint64_t hash) const;
+
+ private:
+  std::vector<uint64_t> hashes_;
+  std::vector<uint32_t> subchannel_indexes_;
+  // Entries whose hashes have the top bits b are the ones in
+  // [bucket_starts_[b], bucket_starts_[b + 1]).
+  int bucket_shift_ = 63;
+  std::vector<uint32_t> bucket_starts_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_HASH_RING_H
@@ -20,6 +20,7 @@
 
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <cmath>
@@ -32,7 +33,6 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
-#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -45,6 +45,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/client_channel_internal.h"
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/hash_ring.h"
 #include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -75,6 +76,11 @@ UniqueTypeName RequestHashAttributeName() {
   return kFactory.Create();
 }
 
+absl::string_view MakeRequestHashAttributeValue(uint64_t hash, Arena* arena) {
+  return absl::string_view(
+      reinterpret_cast<const char*>(arena->New<uint64_t>(hash)), sizeof(hash));
+}
+
 // Helper Parser method
 
 const JsonLoaderInterface* RingHashConfig::JsonLoader(const JsonArgs&) {
@@ -191,18 +197,24 @@ class RingHash : public LoadBalancingPolicy {
    public:
     class Ring : public RefCounted<Ring> {
      public:
-      struct RingEntry {
-        uint64_t hash;
-        size_t subchannel_index;
-      };
-
       Ring(RingHashLbConfig* config, RingHashSubchannelList* subchannel_list,
            const ChannelArgs& args);
 
-      const std::vector<RingEntry>& ring() const { return ring_; }
+      size_t size() const { return entries_.size(); }
+
+      size_t subchannel_index(size_t index) const {
+        return entries_.subchannel_index(index);
+      }
+
+      // Returns the index of the first entry whose hash is not less than
+      // hash, wrapping around to the first entry. Must not be called on an
+      // empty ring.
+      size_t FindEntry(uint64_t hash) const {
+        return entries_.FindEntry(hash);
+      }
 
      private:
-      std::vector<RingEntry> ring_;
+      HashRing entries_;
     };
 
     RingHashSubchannelList(RingHash* policy, ServerAddressList addresses,
@@ -343,38 +355,12 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   auto* call_state = static_cast<ClientChannelLbCallState*>(args.call_state);
   auto hash = call_state->GetCallAttribute(RequestHashAttributeName());
   uint64_t h;
-  if (!absl::SimpleAtoi(hash, &h)) {
-    return PickResult::Fail(
-        absl::InternalError("ring hash value is not a number"));
-  }
-  const auto& ring = ring_->ring();
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and first_index. Do not change them!
-  size_t lowp = 0;
-  size_t highp = ring.size();
-  size_t first_index = 0;
-  while (true) {
-    first_index = (lowp + highp) / 2;
-    if (first_index == ring.size()) {
-      first_index = 0;
-      break;
-    }
-    uint64_t midval = ring[first_index].hash;
-    uint64_t midval1 = first_index == 0 ? 0 : ring[first_index - 1].hash;
-    if (h <= midval && h > midval1) {
-      break;
-    }
-    if (midval < h) {
-      lowp = first_index + 1;
-    } else {
-      highp = first_index - 1;
-    }
-    if (lowp > highp) {
-      first_index = 0;
-      break;
-    }
+  if (hash.size() != sizeof(h)) {
+    return PickResult::Fail(absl::InternalError("ring hash value is not set"));
   }
+  memcpy(&h, hash.data(), sizeof(h));
+  const RingHashSubchannelList::Ring& ring = *ring_;
+  const size_t first_index = ring.FindEntry(h);
   OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
   auto ScheduleSubchannelConnectionAttempt =
       [&](RefCountedPtr<SubchannelInterface> subchannel) {
@@ -386,7 +372,7 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         subchannel_connection_attempter->AddSubchannel(std::move(subchannel));
       };
   SubchannelInfo& first_subchannel =
-      subchannels_[ring[first_index].subchannel_index];
+      subchannels_[ring.subchannel_index(first_index)];
   switch (first_subchannel.state) {
     case GRPC_CHANNEL_READY:
       return PickResult::Complete(first_subchannel.subchannel);
@@ -405,11 +391,10 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   bool found_second_subchannel = false;
   bool found_first_non_failed = false;
   for (size_t i = 1; i < ring.size(); ++i) {
-    const auto& entry = ring[(first_index + i) % ring.size()];
-    if (entry.subchannel_index == ring[first_index].subchannel_index) {
-      continue;
-    }
-    SubchannelInfo& subchannel_info = subchannels_[entry.subchannel_index];
+    const size_t subchannel_index =
+        ring.subchannel_index((first_index + i) % ring.size());
+    if (subchannel_index == ring.subchannel_index(first_index)) continue;
+    SubchannelInfo& subchannel_info = subchannels_[subchannel_index];
     if (subchannel_info.state == GRPC_CHANNEL_READY) {
       return PickResult::Complete(subchannel_info.subchannel);
     }
@@ -501,7 +486,10 @@ RingHash::RingHashSubchannelList::Ring::Ring(
       static_cast<double>(max_ring_size));
   // Reserve memory for the entire ring up front.
   const size_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
+  std::vector<uint64_t> hashes;
+  std::vector<uint32_t> subchannel_indexes;
+  hashes.reserve(ring_size);
+  subchannel_indexes.reserve(ring_size);
   // Populate the hash ring by walking through the (host, weight) pairs in
   // normalized_host_weights, and generating (scale * weight) hashes for each
   // host. Since these aren't necessarily whole numbers, we maintain running
@@ -525,7 +513,8 @@ RingHash::RingHashSubchannelList::Ring::Ring(
       absl::string_view hash_key(hash_key_buffer.data(),
                                  hash_key_buffer.size());
       const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
+      hashes.push_back(hash);
+      subchannel_indexes.push_back(static_cast<uint32_t>(i));
       ++count;
       ++current_hashes;
       hash_key_buffer.erase(offset_start, hash_key_buffer.end());
@@ -535,10 +524,7 @@ RingHash::RingHashSubchannelList::Ring::Ring(
     max_hashes_per_host =
         std::max(static_cast<uint64_t>(i), max_hashes_per_host);
   }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
+  entries_ = HashRing(std::move(hashes), std::move(subchannel_indexes));
 }
 
 //
@@ -563,7 +549,7 @@ RingHash::RingHashSubchannelList::RingHashSubchannelList(
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
     gpr_log(GPR_INFO,
             "[RH %p] created subchannel list %p with %" PRIuPTR " ring entries",
-            policy, this, ring_->ring().size());
+            policy, this, ring_->size());
   }
 }
 
@@ -21,16 +21,23 @@
 
 #include <stdint.h>
 
+#include "absl/strings/string_view.h"
+
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
 #include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/resource_quota/arena.h"
 
 namespace grpc_core {
 
 UniqueTypeName RequestHashAttributeName();
 
+// The request hash attribute holds the raw bytes of the hash, so that the
+// picker does not need to parse it.  The value is allocated on the arena.
+absl::string_view MakeRequestHashAttributeValue(uint64_t hash, Arena* arena);
+
 // Helper Parsing method to parse ring hash policy configs; for example, ring
 // hash size validity.
 struct RingHashConfig {
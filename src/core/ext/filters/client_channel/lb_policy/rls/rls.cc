@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <initializer_list>
 #include <list>
@@ -69,10 +70,14 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/rcu.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -278,8 +283,10 @@ class RlsLb : public LoadBalancingPolicy {
 
     const std::string& target() const { return target_; }
 
-    PickResult Pick(PickArgs args) ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
-      return picker_->Pick(args);
+    // Must be called either while holding RlsLb::mu_ or from within an
+    // RlsLb::rcu_ read section.
+    PickResult Pick(PickArgs args) {
+      return picker_.load(std::memory_order_seq_cst)->Pick(args);
     }
 
     // Updates for the child policy are handled in two phases:
@@ -315,9 +322,8 @@ class RlsLb : public LoadBalancingPolicy {
     // reports TRANSIENT_FAILURE, the function will always return
     // TRANSIENT_FAILURE state instead of the actual state of the child policy
     // until the child policy reports another READY state.
-    grpc_connectivity_state connectivity_state() const
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
-      return connectivity_state_;
+    grpc_connectivity_state connectivity_state() const {
+      return connectivity_state_.load(std::memory_order_relaxed);
     }
 
    private:
@@ -354,10 +360,17 @@ class RlsLb : public LoadBalancingPolicy {
     OrphanablePtr<ChildPolicyHandler> child_policy_;
     RefCountedPtr<LoadBalancingPolicy::Config> pending_config_;
 
-    grpc_connectivity_state connectivity_state_ ABSL_GUARDED_BY(&RlsLb::mu_) =
-        GRPC_CHANNEL_IDLE;
-    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
-        ABSL_GUARDED_BY(&RlsLb::mu_);
+    // Replaces picker_. The old picker is released by RlsLb::FreeRetired(),
+    // since lock-free picks may still be using it.
+    void SetPickerLocked(RefCountedPtr<SubchannelPicker> picker)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Both are written while holding RlsLb::mu_, but also read without it by
+    // picks served from the published cache entries.
+    std::atomic<grpc_connectivity_state> connectivity_state_{
+        GRPC_CHANNEL_IDLE};
+    // Owns a ref.
+    std::atomic<LoadBalancingPolicy::SubchannelPicker*> picker_{nullptr};
   };
 
   // A picker that uses the cache and the request map in the LB policy
@@ -450,7 +463,32 @@ class RlsLb : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      // Records a pick served from the published copy of the entry, which
+      // cannot move it in the LRU list. Eviction gives such entries a second
+      // chance instead.
+      void MarkReferenced() {
+        if (!referenced_.load(std::memory_order_relaxed)) {
+          referenced_.store(true, std::memory_order_relaxed);
+        }
+      }
+      bool TakeReferenced() {
+        return referenced_.exchange(false, std::memory_order_relaxed);
+      }
+
+      // Picks from the first target that is not in TRANSIENT_FAILURE (or
+      // from the last one), adding the header data to the request. Must be
+      // called either while holding RlsLb::mu_ or from within an RlsLb::rcu_
+      // read section.
+      static PickResult PickFromTargets(
+          RlsLb* lb_policy, const RequestKey& key,
+          const std::vector<RefCountedPtr<ChildPolicyWrapper>>&
+              child_policy_wrappers,
+          const std::string& header_data, PickArgs args);
+
      private:
+      // Publishes the entry's current data for lock-free picks.
+      void PublishLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
       class BackoffTimer : public InternallyRefCounted<BackoffTimer> {
        public:
         BackoffTimer(RefCountedPtr<Entry> entry, Timestamp backoff_time);
@@ -491,9 +529,53 @@ class RlsLb : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      bool is_published_ ABSL_GUARDED_BY(&RlsLb::mu_) = false;
+      std::atomic<bool> referenced_{false};
     };
 
     explicit Cache(RlsLb* lb_policy);
+    ~Cache();
+
+    // Serves the pick from the published copy of the entry for the key, if
+    // there is one whose data is neither stale nor expired. Such picks need
+    // neither an RLS request nor the lock. Returns nullopt if the caller
+    // needs to go through the locked path.
+    absl::optional<PickResult> PickPublished(const RequestKey& key,
+                                             Timestamp now, PickArgs args)
+        ABSL_LOCKS_EXCLUDED(&RlsLb::mu_);
+
+    // An immutable copy of the data of an entry, published so that picks can
+    // use it without taking the lock. Publishing new data for an entry
+    // replaces its node in place.
+    struct PublishedNode {
+      RequestKey key;
+      RefCountedPtr<Entry> entry;
+      std::vector<RefCountedPtr<ChildPolicyWrapper>> child_policy_wrappers;
+      std::string header_data;
+      Timestamp stale_time;
+      Timestamp data_expiration_time;
+      std::atomic<PublishedNode*> next{nullptr};
+    };
+
+    // A hash table of published nodes, chained through PublishedNode::next.
+    // Links are changed while holding RlsLb::mu_ and followed by picks
+    // inside RlsLb::rcu_ read sections.
+    struct PublishedTable {
+      explicit PublishedTable(size_t num_buckets) : buckets(num_buckets) {}
+      std::vector<std::atomic<PublishedNode*>> buckets;
+    };
+
+    // Published data that has been unlinked, but that lock-free picks may
+    // still be using.
+    struct Retired {
+      std::vector<std::unique_ptr<PublishedNode>> nodes;
+      std::vector<std::unique_ptr<PublishedTable>> tables;
+    };
+
+    // Returns the data unlinked since the last call. The caller must wait
+    // for RlsLb::rcu_ before releasing it, and must hold the lock while doing
+    // so, since releasing an entry may orphan child policy wrappers.
+    Retired TakeRetired() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
     // Finds an entry from the cache that corresponds to a key. If an entry is
     // not found, nullptr is returned. Otherwise, the entry is considered
@@ -521,6 +603,25 @@ class RlsLb : public LoadBalancingPolicy {
     void Shutdown() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
    private:
+    static constexpr size_t kMinPublishedBuckets = 16;
+
+    // Returns the link that points to the node published for the key, or
+    // the null link at the end of the key's bucket if there is none.
+    std::atomic<PublishedNode*>* FindPublishedLink(const RequestKey& key)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Publishes a node for PickPublished(), replacing any node previously
+    // published for its key.
+    void Publish(std::unique_ptr<PublishedNode> node)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Removes the node published for the key, if any.
+    void Unpublish(const RequestKey& key)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Doubles the number of buckets, which copies all the published nodes.
+    void GrowPublished() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
     // Shared logic for starting the cleanup timer
     void StartCleanupTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
@@ -543,6 +644,12 @@ class RlsLb : public LoadBalancingPolicy {
     std::unordered_map<RequestKey, OrphanablePtr<Entry>, absl::Hash<RequestKey>>
         map_ ABSL_GUARDED_BY(&RlsLb::mu_);
     absl::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
+
+    // Read by PickPublished() inside RlsLb::rcu_ read sections; replaced by
+    // GrowPublished().
+    std::atomic<PublishedTable*> published_;
+    size_t num_published_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
+    Retired retired_ ABSL_GUARDED_BY(&RlsLb::mu_);
   };
 
   // Channel for communicating with the RLS server.
@@ -693,15 +800,27 @@ class RlsLb : public LoadBalancingPolicy {
   static void UpdatePickerCallback(void* arg, grpc_error_handle error);
   // Updates the picker in the work serializer.
   void UpdatePickerLocked() ABSL_LOCKS_EXCLUDED(&mu_);
+  // Waits for the lock-free picks that may still be using the data retired
+  // by the cache and by the child policy wrappers, then releases it. Waits
+  // without holding the lock. Must be called from within the WorkSerializer,
+  // which serializes the calls to rcu_.Synchronize().
+  void FreeRetired() ABSL_LOCKS_EXCLUDED(&mu_);
 
   // The name of the server for the channel.
   std::string server_name_;
 
   // Mutex to guard LB policy state that is accessed by the picker.
   Mutex mu_;
+  // Lets picks use the published cache entries and the child policies'
+  // pickers without holding mu_.
+  Rcu rcu_;
+  std::vector<RefCountedPtr<SubchannelPicker>> retired_pickers_
+      ABSL_GUARDED_BY(mu_);
   bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
   bool update_in_progress_ = false;
-  Cache cache_ ABSL_GUARDED_BY(mu_);
+  // The members of the cache are annotated individually, since the
+  // published entries are read without the lock.
+  Cache cache_;
   // Maps an RLS request key to an RlsRequest object that represents a pending
   // RLS request.
   std::unordered_map<RequestKey, OrphanablePtr<RlsRequest>,
@@ -732,7 +851,7 @@ RlsLb::ChildPolicyWrapper::ChildPolicyWrapper(RefCountedPtr<RlsLb> lb_policy,
                                                      : nullptr),
       lb_policy_(lb_policy),
       target_(std::move(target)),
-      picker_(MakeRefCounted<QueuePicker>(std::move(lb_policy))) {
+      picker_(MakeRefCounted<QueuePicker>(std::move(lb_policy)).release()) {
   lb_policy_->child_policy_map_.emplace(target_, this);
 }
 
@@ -748,7 +867,20 @@ void RlsLb::ChildPolicyWrapper::Orphan() {
                                      lb_policy_->interested_parties());
     child_policy_.reset();
   }
-  picker_.reset();
+  // Only published cache entries, which hold strong refs to us, can reach
+  // picker_ without the lock, so there is no need to synchronize here.
+  SubchannelPicker* picker =
+      picker_.exchange(nullptr, std::memory_order_seq_cst);
+  if (picker != nullptr) picker->Unref();
+}
+
+void RlsLb::ChildPolicyWrapper::SetPickerLocked(
+    RefCountedPtr<SubchannelPicker> picker) {
+  SubchannelPicker* old_picker =
+      picker_.exchange(picker.release(), std::memory_order_seq_cst);
+  if (old_picker != nullptr) {
+    lb_policy_->retired_pickers_.emplace_back(old_picker);
+  }
 }
 
 bool InsertOrUpdateChildPolicyField(const std::string& field,
@@ -813,8 +945,8 @@ void RlsLb::ChildPolicyWrapper::StartUpdate() {
               config.status().ToString().c_str());
     }
     pending_config_.reset();
-    picker_ = MakeRefCounted<TransientFailurePicker>(
-        absl::UnavailableError(config.status().message()));
+    SetPickerLocked(MakeRefCounted<TransientFailurePicker>(
+        absl::UnavailableError(config.status().message())));
     child_policy_.reset();
   } else {
     pending_config_ = std::move(*config);
@@ -890,16 +1022,17 @@ void RlsLb::ChildPolicyWrapper::ChildPolicyHelper::UpdateState(
   {
     MutexLock lock(&wrapper_->lb_policy_->mu_);
     if (wrapper_->is_shutdown_) return;
-    if (wrapper_->connectivity_state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+    if (wrapper_->connectivity_state() == GRPC_CHANNEL_TRANSIENT_FAILURE &&
         state != GRPC_CHANNEL_READY) {
       return;
     }
-    wrapper_->connectivity_state_ = state;
+    wrapper_->connectivity_state_.store(state, std::memory_order_relaxed);
     GPR_DEBUG_ASSERT(picker != nullptr);
     if (picker != nullptr) {
-      wrapper_->picker_ = std::move(picker);
+      wrapper_->SetPickerLocked(std::move(picker));
     }
   }
+  wrapper_->lb_policy_->FreeRetired();
   wrapper_->lb_policy_->UpdatePickerLocked();
 }
 
@@ -1017,6 +1150,14 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
             lb_policy_.get(), this, key.ToString().c_str());
   }
   Timestamp now = Timestamp::Now();
+  // Fresh cache hits can be served without the lock.
+  absl::optional<PickResult> result =
+      lb_policy_->cache_.PickPublished(key, now, args);
+  if (result.has_value()) {
+    global_stats().IncrementRlsLockFreePicks();
+    return std::move(*result);
+  }
+  global_stats().IncrementRlsLockedPicks();
   MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
@@ -1180,6 +1321,10 @@ void RlsLb::Cache::Entry::Orphan() {
             lb_policy_.get(), this, lru_iterator_->ToString().c_str());
   }
   is_shutdown_ = true;
+  if (is_published_) {
+    lb_policy_->cache_.Unpublish(*lru_iterator_);
+    is_published_ = false;
+  }
   lb_policy_->cache_.lru_list_.erase(lru_iterator_);
   lru_iterator_ = lb_policy_->cache_.lru_list_.end();  // Just in case.
   backoff_state_.reset();
@@ -1198,21 +1343,30 @@ size_t RlsLb::Cache::Entry::Size() const {
 }
 
 LoadBalancingPolicy::PickResult RlsLb::Cache::Entry::Pick(PickArgs args) {
+  return PickFromTargets(lb_policy_.get(), *lru_iterator_,
+                         child_policy_wrappers_, header_data_, args);
+}
+
+LoadBalancingPolicy::PickResult RlsLb::Cache::Entry::PickFromTargets(
+    RlsLb* lb_policy, const RequestKey& key,
+    const std::vector<RefCountedPtr<ChildPolicyWrapper>>&
+        child_policy_wrappers,
+    const std::string& header_data, PickArgs args) {
   size_t i = 0;
   ChildPolicyWrapper* child_policy_wrapper = nullptr;
   // Skip targets before the last one that are in state TRANSIENT_FAILURE.
-  for (; i < child_policy_wrappers_.size(); ++i) {
-    child_policy_wrapper = child_policy_wrappers_[i].get();
+  for (; i < child_policy_wrappers.size(); ++i) {
+    child_policy_wrapper = child_policy_wrappers[i].get();
     if (child_policy_wrapper->connectivity_state() ==
             GRPC_CHANNEL_TRANSIENT_FAILURE &&
-        i < child_policy_wrappers_.size() - 1) {
+        i < child_policy_wrappers.size() - 1) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
         gpr_log(GPR_INFO,
-                "[rlslb %p] cache entry=%p %s: target %s (%" PRIuPTR
+                "[rlslb %p] cache entry %s: target %s (%" PRIuPTR
                 " of %" PRIuPTR ") in state TRANSIENT_FAILURE; skipping",
-                lb_policy_.get(), this, lru_iterator_->ToString().c_str(),
+                lb_policy, key.ToString().c_str(),
                 child_policy_wrapper->target().c_str(), i,
-                child_policy_wrappers_.size());
+                child_policy_wrappers.size());
       }
       continue;
     }
@@ -1222,21 +1376,21 @@ LoadBalancingPolicy::PickResult RlsLb::Cache::Entry::Pick(PickArgs args) {
   // the list, so delegate.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
     gpr_log(GPR_INFO,
-            "[rlslb %p] cache entry=%p %s: target %s (%" PRIuPTR " of %" PRIuPTR
+            "[rlslb %p] cache entry %s: target %s (%" PRIuPTR " of %" PRIuPTR
             ") in state %s; delegating",
-            lb_policy_.get(), this, lru_iterator_->ToString().c_str(),
+            lb_policy, key.ToString().c_str(),
             child_policy_wrapper->target().c_str(), i,
-            child_policy_wrappers_.size(),
+            child_policy_wrappers.size(),
             ConnectivityStateName(child_policy_wrapper->connectivity_state()));
   }
   // Add header data.
   // Note that even if the target we're using is in TRANSIENT_FAILURE,
   // the pick might still succeed (e.g., if the child is ring_hash), so
   // we need to pass the right header info down in all cases.
-  if (!header_data_.empty()) {
+  if (!header_data.empty()) {
     char* copied_header_data =
-        static_cast<char*>(args.call_state->Alloc(header_data_.length() + 1));
-    strcpy(copied_header_data, header_data_.c_str());
+        static_cast<char*>(args.call_state->Alloc(header_data.length() + 1));
+    strcpy(copied_header_data, header_data.c_str());
     args.initial_metadata->Add(kRlsHeaderKey, copied_header_data);
   }
   return child_policy_wrapper->Pick(args);
@@ -1264,6 +1418,18 @@ void RlsLb::Cache::Entry::MarkUsed() {
   lru_iterator_ = new_it;
 }
 
+void RlsLb::Cache::Entry::PublishLocked() {
+  auto node = std::make_unique<PublishedNode>();
+  node->key = *lru_iterator_;
+  node->entry = Ref(DEBUG_LOCATION, "PublishedNode");
+  node->child_policy_wrappers = child_policy_wrappers_;
+  node->header_data = header_data_;
+  node->stale_time = stale_time_;
+  node->data_expiration_time = data_expiration_time_;
+  lb_policy_->cache_.Publish(std::move(node));
+  is_published_ = true;
+}
+
 std::vector<RlsLb::ChildPolicyWrapper*>
 RlsLb::Cache::Entry::OnRlsResponseLocked(
     ResponseInfo response, std::unique_ptr<BackOff> backoff_state) {
@@ -1309,6 +1475,7 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
     // Targets didn't change, so we're not updating the list of child
     // policies.  Return a new picker so that any queued requests can be
     // re-processed.
+    PublishLocked();
     lb_policy_->UpdatePickerAsync();
     return {};
   }
@@ -1343,6 +1510,7 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
     }
   }
   child_policy_wrappers_ = std::move(new_child_policy_wrappers);
+  PublishLocked();
   if (update_picker) {
     lb_policy_->UpdatePickerAsync();
   }
@@ -1353,10 +1521,121 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
 // RlsLb::Cache
 //
 
-RlsLb::Cache::Cache(RlsLb* lb_policy) : lb_policy_(lb_policy) {
+RlsLb::Cache::Cache(RlsLb* lb_policy)
+    : lb_policy_(lb_policy),
+      published_(new PublishedTable(kMinPublishedBuckets)) {
   StartCleanupTimer();
 }
 
+RlsLb::Cache::~Cache() {
+  PublishedTable* table = published_.load(std::memory_order_relaxed);
+  for (std::atomic<PublishedNode*>& bucket : table->buckets) {
+    PublishedNode* node = bucket.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      PublishedNode* next = node->next.load(std::memory_order_relaxed);
+      delete node;
+      node = next;
+    }
+  }
+  delete table;
+}
+
+absl::optional<LoadBalancingPolicy::PickResult> RlsLb::Cache::PickPublished(
+    const RequestKey& key, Timestamp now, PickArgs args) {
+  Rcu::ReadSection read_section(&lb_policy_->rcu_);
+  const PublishedTable* table = published_.load(std::memory_order_seq_cst);
+  const PublishedNode* node =
+      table->buckets[absl::Hash<RequestKey>()(key) % table->buckets.size()]
+          .load(std::memory_order_seq_cst);
+  while (node != nullptr && !(node->key == key)) {
+    node = node->next.load(std::memory_order_seq_cst);
+  }
+  if (node == nullptr) return absl::nullopt;
+  // Stale data needs a refresh, which only the locked path can start.
+  if (node->stale_time < now || node->data_expiration_time < now) {
+    return absl::nullopt;
+  }
+  node->entry->MarkReferenced();
+  return Entry::PickFromTargets(lb_policy_, key, node->child_policy_wrappers,
+                                node->header_data, args);
+}
+
+RlsLb::Cache::Retired RlsLb::Cache::TakeRetired() {
+  return std::exchange(retired_, Retired());
+}
+
+std::atomic<RlsLb::Cache::PublishedNode*>* RlsLb::Cache::FindPublishedLink(
+    const RequestKey& key) {
+  PublishedTable* table = published_.load(std::memory_order_relaxed);
+  std::atomic<PublishedNode*>* link =
+      &table->buckets[absl::Hash<RequestKey>()(key) % table->buckets.size()];
+  while (true) {
+    PublishedNode* node = link->load(std::memory_order_relaxed);
+    if (node == nullptr || node->key == key) return link;
+    link = &node->next;
+  }
+}
+
+void RlsLb::Cache::Publish(std::unique_ptr<PublishedNode> node) {
+  std::atomic<PublishedNode*>* link = FindPublishedLink(node->key);
+  PublishedNode* old_node = link->load(std::memory_order_relaxed);
+  if (old_node != nullptr) {
+    // Picks that are on the old node can still follow it to the rest of
+    // the bucket.
+    node->next.store(old_node->next.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+    retired_.nodes.emplace_back(old_node);
+  } else {
+    ++num_published_;
+  }
+  link->store(node.release(), std::memory_order_seq_cst);
+  if (num_published_ >
+      published_.load(std::memory_order_relaxed)->buckets.size()) {
+    GrowPublished();
+  }
+}
+
+void RlsLb::Cache::Unpublish(const RequestKey& key) {
+  std::atomic<PublishedNode*>* link = FindPublishedLink(key);
+  PublishedNode* node = link->load(std::memory_order_relaxed);
+  if (node == nullptr) return;
+  link->store(node->next.load(std::memory_order_relaxed),
+              std::memory_order_seq_cst);
+  retired_.nodes.emplace_back(node);
+  --num_published_;
+}
+
+void RlsLb::Cache::GrowPublished() {
+  PublishedTable* old_table = published_.load(std::memory_order_relaxed);
+  auto new_table =
+      std::make_unique<PublishedTable>(old_table->buckets.size() * 2);
+  // Picks may be walking the old table, so its nodes stay linked as they
+  // are, and the new table gets copies.
+  for (std::atomic<PublishedNode*>& bucket : old_table->buckets) {
+    PublishedNode* node = bucket.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      auto copy = std::make_unique<PublishedNode>();
+      copy->key = node->key;
+      copy->entry = node->entry;
+      copy->child_policy_wrappers = node->child_policy_wrappers;
+      copy->header_data = node->header_data;
+      copy->stale_time = node->stale_time;
+      copy->data_expiration_time = node->data_expiration_time;
+      std::atomic<PublishedNode*>& new_bucket =
+          new_table->buckets[absl::Hash<RequestKey>()(copy->key) %
+                             new_table->buckets.size()];
+      copy->next.store(new_bucket.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+      new_bucket.store(copy.release(), std::memory_order_relaxed);
+      PublishedNode* next = node->next.load(std::memory_order_relaxed);
+      retired_.nodes.emplace_back(node);
+      node = next;
+    }
+  }
+  published_.store(new_table.release(), std::memory_order_seq_cst);
+  retired_.tables.emplace_back(old_table);
+}
+
 RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
   auto it = map_.find(key);
   if (it == map_.end()) return nullptr;
@@ -1439,31 +1718,44 @@ void RlsLb::Cache::OnCleanupTimer() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
     gpr_log(GPR_INFO, "[rlslb %p] cache cleanup timer fired", lb_policy_);
   }
-  MutexLock lock(&lb_policy_->mu_);
-  if (!cleanup_timer_handle_.has_value()) return;
-  if (lb_policy_->is_shutdown_) return;
-  for (auto it = map_.begin(); it != map_.end();) {
-    if (GPR_UNLIKELY(it->second->ShouldRemove() && it->second->CanEvict())) {
-      size_ -= it->second->Size();
-      it = map_.erase(it);
-    } else {
-      ++it;
+  {
+    MutexLock lock(&lb_policy_->mu_);
+    if (!cleanup_timer_handle_.has_value()) return;
+    if (lb_policy_->is_shutdown_) return;
+    for (auto it = map_.begin(); it != map_.end();) {
+      if (GPR_UNLIKELY(it->second->ShouldRemove() && it->second->CanEvict())) {
+        size_ -= it->second->Size();
+        it = map_.erase(it);
+      } else {
+        ++it;
+      }
     }
+    StartCleanupTimer();
   }
-  StartCleanupTimer();
+  lb_policy_->FreeRetired();
 }
 
 size_t RlsLb::Cache::EntrySizeForKey(const RequestKey& key) {
   // Key is stored twice, once in LRU list and again in the cache map.
+  // The copies published for lock-free picks are not counted.
   return (key.Size() * 2) + sizeof(Entry);
 }
 
 void RlsLb::Cache::MaybeShrinkSize(size_t bytes) {
+  // Lock-free picks cannot reorder the LRU list, so entries they used since
+  // last being considered for eviction get a second chance instead. Each
+  // entry gets at most one per pass.
+  size_t second_chances = lru_list_.size();
   while (size_ > bytes) {
     auto lru_it = lru_list_.begin();
     if (GPR_UNLIKELY(lru_it == lru_list_.end())) break;
     auto map_it = map_.find(*lru_it);
     GPR_ASSERT(map_it != map_.end());
+    if (second_chances > 0 && map_it->second->TakeReferenced()) {
+      --second_chances;
+      map_it->second->MarkUsed();
+      continue;
+    }
     if (!map_it->second->CanEvict()) break;
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
       gpr_log(GPR_INFO, "[rlslb %p] LRU eviction: removing entry %p %s",
@@ -1818,6 +2110,7 @@ void RlsLb::RlsRequest::OnRlsCallCompleteLocked(grpc_error_handle error) {
         std::move(response), std::move(backoff_state_));
     lb_policy_->request_map_.erase(key_);
   }
+  lb_policy_->FreeRetired();
   // Now that we've released the lock, finish the update on any newly
   // created child policies.
   for (ChildPolicyWrapper* child : child_policies_to_finish_update) {
@@ -2001,6 +2294,7 @@ absl::Status RlsLb::UpdateLocked(UpdateArgs args) {
       default_child_policy_->StartUpdate();
     }
   }
+  FreeRetired();
   // Now that we've released the lock, finish update of child policies.
   std::vector<std::string> errors;
   if (update_child_policies) {
@@ -2063,14 +2357,35 @@ void RlsLb::ShutdownLocked() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
     gpr_log(GPR_INFO, "[rlslb %p] policy shutdown", this);
   }
+  {
+    MutexLock lock(&mu_);
+    is_shutdown_ = true;
+    config_.reset(DEBUG_LOCATION, "ShutdownLocked");
+    channel_args_ = ChannelArgs();
+    cache_.Shutdown();
+    request_map_.clear();
+    rls_channel_.reset();
+    default_child_policy_.reset();
+  }
+  FreeRetired();
+}
+
+void RlsLb::FreeRetired() {
+  Cache::Retired retired;
+  std::vector<RefCountedPtr<SubchannelPicker>> retired_pickers;
+  {
+    MutexLock lock(&mu_);
+    retired = cache_.TakeRetired();
+    retired_pickers.swap(retired_pickers_);
+  }
+  if (retired.nodes.empty() && retired.tables.empty() &&
+      retired_pickers.empty()) {
+    return;
+  }
+  rcu_.Synchronize();
   MutexLock lock(&mu_);
-  is_shutdown_ = true;
-  config_.reset(DEBUG_LOCATION, "ShutdownLocked");
-  channel_args_ = ChannelArgs();
-  cache_.Shutdown();
-  request_map_.clear();
-  rls_channel_.reset();
-  default_child_policy_.reset();
+  retired.nodes.clear();
+  retired_pickers.clear();
 }
 
 void RlsLb::UpdatePickerAsync() {
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -35,6 +36,7 @@
 #include "absl/types/optional.h"
 
 #include <grpc/impl/connectivity_state.h>
+#include <grpc/impl/grpc_types.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
@@ -97,6 +99,11 @@ class RoundRobin : public LoadBalancingPolicy {
       return logical_connectivity_state_;
     }
 
+    // Requests a connection if the subchannel is IDLE, and counts it as a
+    // connection attempt until the subchannel leaves CONNECTING. Returns
+    // false if the subchannel was not IDLE.
+    bool StartConnectionAttemptLocked();
+
    private:
     // Performs connectivity state updates that need to be done only
     // after we have started watching.
@@ -114,6 +121,9 @@ class RoundRobin : public LoadBalancingPolicy {
     // TRANSIENT_FAILURE, we ignore any subsequent state changes until
     // we see READY).
     absl::optional<grpc_connectivity_state> logical_connectivity_state_;
+
+    // Whether a connection attempt that we requested is in progress.
+    bool connection_attempt_running_ = false;
   };
 
   // A list of subchannels.
@@ -128,7 +138,10 @@ class RoundRobin : public LoadBalancingPolicy {
                               ? "RoundRobinSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args),
+          max_concurrent_connects_(std::max(
+              0, args.GetInt(GRPC_ARG_ROUND_ROBIN_MAX_CONCURRENT_CONNECTS)
+                     .value_or(0))) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -152,6 +165,14 @@ class RoundRobin : public LoadBalancingPolicy {
     void MaybeUpdateRoundRobinConnectivityStateLocked(
         absl::Status status_for_tf);
 
+    // Starts a connection attempt on an IDLE subchannel, or queues it if
+    // max_concurrent_connects_ attempts are already running.
+    void RequestConnectionLocked(RoundRobinSubchannelData* sd);
+
+    // Called when a connection attempt started by
+    // RequestConnectionLocked() ends. Starts the next queued attempt.
+    void ConnectionAttemptFinishedLocked();
+
    private:
     std::string CountersString() const {
       return absl::StrCat("num_subchannels=", num_subchannels(),
@@ -165,6 +186,11 @@ class RoundRobin : public LoadBalancingPolicy {
     size_t num_transient_failure_ = 0;
 
     absl::Status last_failure_;
+
+    // 0 means no limit.
+    const size_t max_concurrent_connects_;
+    size_t num_connection_attempts_ = 0;
+    std::deque<RoundRobinSubchannelData*> queued_connection_attempts_;
   };
 
   class Picker : public SubchannelPicker {
@@ -418,10 +444,51 @@ void RoundRobin::RoundRobinSubchannelList::
   }
 }
 
+void RoundRobin::RoundRobinSubchannelList::RequestConnectionLocked(
+    RoundRobinSubchannelData* sd) {
+  if (max_concurrent_connects_ > 0 &&
+      num_connection_attempts_ >= max_concurrent_connects_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
+      gpr_log(GPR_INFO,
+              "[RR %p] subchannel list %p: %" PRIuPTR
+              " connection attempts running, queueing subchannel %p",
+              policy(), this, num_connection_attempts_, sd->subchannel());
+    }
+    queued_connection_attempts_.push_back(sd);
+    return;
+  }
+  if (sd->StartConnectionAttemptLocked()) ++num_connection_attempts_;
+}
+
+void RoundRobin::RoundRobinSubchannelList::ConnectionAttemptFinishedLocked() {
+  GPR_ASSERT(num_connection_attempts_ > 0);
+  --num_connection_attempts_;
+  // Skip subchannels that are no longer IDLE, e.g. because another channel
+  // sharing them has connected them in the meantime.
+  while (!queued_connection_attempts_.empty()) {
+    RoundRobinSubchannelData* sd = queued_connection_attempts_.front();
+    queued_connection_attempts_.pop_front();
+    if (sd->StartConnectionAttemptLocked()) {
+      ++num_connection_attempts_;
+      return;
+    }
+  }
+}
+
 //
 // RoundRobinSubchannelData
 //
 
+bool RoundRobin::RoundRobinSubchannelData::StartConnectionAttemptLocked() {
+  if (connection_attempt_running_ ||
+      SubchannelData::connectivity_state() != GRPC_CHANNEL_IDLE) {
+    return false;
+  }
+  connection_attempt_running_ = true;
+  subchannel()->RequestConnection();
+  return true;
+}
+
 void RoundRobin::RoundRobinSubchannelData::ProcessConnectivityChangeLocked(
     absl::optional<grpc_connectivity_state> old_state,
     grpc_connectivity_state new_state) {
@@ -440,13 +507,19 @@ void RoundRobin::RoundRobinSubchannelData::ProcessConnectivityChangeLocked(
     }
     p->channel_control_helper()->RequestReresolution();
   }
+  // A connection attempt that we started ends when the subchannel leaves
+  // CONNECTING.
+  if (connection_attempt_running_ && new_state != GRPC_CHANNEL_CONNECTING) {
+    connection_attempt_running_ = false;
+    subchannel_list()->ConnectionAttemptFinishedLocked();
+  }
   if (new_state == GRPC_CHANNEL_IDLE) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
       gpr_log(GPR_INFO,
               "[RR %p] Subchannel %p reported IDLE; requesting connection", p,
               subchannel());
     }
-    subchannel()->RequestConnection();
+    subchannel_list()->RequestConnectionLocked(this);
   }
   // Update logical connectivity state.
   UpdateLogicalConnectivityStateLocked(new_state);
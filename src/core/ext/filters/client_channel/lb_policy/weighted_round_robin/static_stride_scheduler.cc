@@ -31,7 +31,18 @@
 namespace grpc_core {
 
 namespace {
+
 constexpr uint16_t kMaxWeight = std::numeric_limits<uint16_t>::max();
+
+// Limits for the pick table built by MakeBatched(). The table holds at most
+// kMaxBatchedPicks entries, and weights are rescaled so that the max weight
+// is picked `resolution` times per cycle, where resolution is as large as
+// fits in the table, up to kMaxBatchedResolution. Below
+// kMinBatchedResolution, the table is not worth its loss of precision.
+constexpr size_t kMaxBatchedPicks = 1 << 16;
+constexpr size_t kMaxBatchedResolution = 1024;
+constexpr size_t kMinBatchedResolution = 64;
+
 }  // namespace
 
 absl::optional<StaticStrideScheduler> StaticStrideScheduler::Make(
@@ -82,6 +93,50 @@ absl::optional<StaticStrideScheduler> StaticStrideScheduler::Make(
                                std::move(next_sequence_func)};
 }
 
+absl::optional<StaticStrideScheduler> StaticStrideScheduler::MakeBatched(
+    absl::Span<const float> float_weights,
+    absl::AnyInvocable<uint32_t()> next_sequence_func) {
+  absl::optional<StaticStrideScheduler> scheduler =
+      Make(float_weights, std::move(next_sequence_func));
+  if (!scheduler.has_value()) return absl::nullopt;
+  const std::vector<uint16_t>& weights = scheduler->weights_;
+  const size_t n = weights.size();
+  const size_t resolution =
+      std::min(kMaxBatchedResolution, kMaxBatchedPicks / n);
+  if (resolution < kMinBatchedResolution) return scheduler;
+
+  // Rescale the weights so that the max is `resolution`. Non-zero weights
+  // are kept non-zero so that every backend still gets picks.
+  std::vector<uint32_t> scaled_weights;
+  scaled_weights.reserve(n);
+  size_t num_picks = 0;
+  for (const uint16_t weight : weights) {
+    scaled_weights.push_back(std::max<uint32_t>(
+        1, (static_cast<uint32_t>(weight) * resolution + kMaxWeight / 2) /
+               kMaxWeight));
+    num_picks += scaled_weights.back();
+  }
+
+  // Run Pick()'s stride decision over every (generation, backend) pair of a
+  // cycle with `resolution` generations, keeping only the picks. Each
+  // backend is picked exactly its scaled weight times.
+  const uint32_t offset = resolution / 2;
+  std::vector<uint16_t>& picks = scheduler->picks_;
+  picks.reserve(num_picks);
+  for (uint32_t generation = 0; generation < resolution; ++generation) {
+    for (size_t backend_index = 0; backend_index < n; ++backend_index) {
+      const uint32_t weight = scaled_weights[backend_index];
+      const uint32_t mod =
+          (weight * generation + backend_index * offset) % resolution;
+      if (mod >= resolution - weight) {
+        picks.push_back(static_cast<uint16_t>(backend_index));
+      }
+    }
+  }
+  GPR_ASSERT(picks.size() == num_picks);
+  return scheduler;
+}
+
 StaticStrideScheduler::StaticStrideScheduler(
     std::vector<uint16_t> weights,
     absl::AnyInvocable<uint32_t()> next_sequence_func)
@@ -91,6 +146,9 @@ StaticStrideScheduler::StaticStrideScheduler(
 }
 
 size_t StaticStrideScheduler::Pick() const {
+  // The sequence number wraps at a multiple of picks_.size() only if that is
+  // a power of two, so there is a small discontinuity when it wraps.
+  if (!picks_.empty()) return picks_[next_sequence_func_() % picks_.size()];
   while (true) {
     const uint32_t sequence = next_sequence_func_();
 
@@ -39,6 +39,12 @@ namespace grpc_core {
 // Construction is O(|weights|).  Picking is O(1) if weights are similar, or
 // O(|weights|) if the mean of the non-zero weights is a small fraction of the
 // max. Stores two bytes per weight.
+//
+// A scheduler built with MakeBatched() instead precomputes one full cycle of
+// picks at a coarser weight resolution, so that every pick is a single
+// `next_sequence_func` call and an array lookup regardless of how skewed the
+// weights are. Construction is then O(|weights| * resolution), and the table
+// takes up to 128 KiB.
 class StaticStrideScheduler {
  public:
   // Constructs and returns a new StaticStrideScheduler, or nullopt if all
@@ -51,8 +57,18 @@ class StaticStrideScheduler {
       absl::Span<const float> float_weights,
       absl::AnyInvocable<uint32_t()> next_sequence_func);
 
+  // Like Make(), but precomputes the picks as described above. Picks are
+  // weighted with a resolution of at least 1/64 of the max weight. If there
+  // are too many weights to do that within the table size limit, returns a
+  // scheduler that picks like one returned by Make(). WRR only uses this
+  // under the wrr_batched_scheduler experiment.
+  static absl::optional<StaticStrideScheduler> MakeBatched(
+      absl::Span<const float> float_weights,
+      absl::AnyInvocable<uint32_t()> next_sequence_func);
+
   // Returns the index of the next pick. May invoke `next_sequence_func`
-  // multiple times. The returned value is guaranteed to be in [0, |weights|).
+  // multiple times, unless the scheduler was built with MakeBatched(). The
+  // returned value is guaranteed to be in [0, |weights|).
   // Can be called concurrently iff `next_sequence_func` can.
   size_t Pick() const;
 
@@ -64,6 +80,10 @@ class StaticStrideScheduler {
 
   // List of backend weights scaled such that the max(weights_) == kMaxWeight.
   std::vector<uint16_t> weights_;
+
+  // If non-empty, the backend indexes picked by one full cycle of sequence
+  // numbers, in order. Only set by MakeBatched().
+  std::vector<uint16_t> picks_;
 };
 
 }  // namespace grpc_core
@@ -52,6 +52,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -554,8 +555,17 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
     gpr_log(GPR_INFO, "[WRR %p picker %p] new weights: %s", wrr_.get(), this,
             absl::StrJoin(weights, " ").c_str());
   }
-  auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
+  // The batched scheduler trades weight precision for cheaper picks, so it
+  // is only used under an experiment.
+  auto next_sequence_func = [this]() {
+    return wrr_->scheduler_state_.fetch_add(1);
+  };
+  auto scheduler_or =
+      IsWrrBatchedSchedulerEnabled()
+          ? StaticStrideScheduler::MakeBatched(weights,
+                                               std::move(next_sequence_func))
+          : StaticStrideScheduler::Make(weights,
+                                        std::move(next_sequence_func));
   std::shared_ptr<StaticStrideScheduler> scheduler;
   if (scheduler_or.has_value()) {
     scheduler =
@@ -0,0 +1,599 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/request_coalescing_filter.h"
+
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/request_coalescing_service_config.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/call_combiner.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/service_config/service_config_call_data.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/transport.h"
+
+// Coalesces identical in-flight unary calls.
+//
+// The client channel adds this filter only when some method in the service
+// config enables coalescing. A call is then eligible if its method config sets
+// "coalesceIdenticalRequests" and its first batch carries the whole request
+// (initial metadata, message and half-close), which is how unary calls are
+// started. The first such call for a given method, request metadata and
+// serialized request becomes the leader and proceeds normally. Identical calls
+// that start while the leader is in flight become followers: nothing of theirs
+// is sent, and once the leader's trailing metadata arrives they are completed
+// with copies of its response.
+//
+// If the leader is cancelled by its own application (including by its
+// deadline), its followers fail with UNAVAILABLE rather than inheriting the
+// cancellation. The deadline is not part of the match, but calls with call
+// credentials are never coalesced, so that no call gets a response produced
+// for another principal. Coalescing should still only be enabled for
+// idempotent methods.
+
+namespace grpc_core {
+
+TraceFlag grpc_request_coalescing_trace(false, "request_coalescing");
+
+namespace {
+
+class RequestCoalescingFilter {
+ public:
+  class CallData;
+
+  static grpc_error_handle Init(grpc_channel_element* elem,
+                                grpc_channel_element_args* args) {
+    GPR_ASSERT(!args->is_last);
+    GPR_ASSERT(elem->filter == &kRequestCoalescingFilterVtable);
+    new (elem->channel_data) RequestCoalescingFilter(args->channel_args);
+    return absl::OkStatus();
+  }
+
+  static void Destroy(grpc_channel_element* elem) {
+    auto* chand = static_cast<RequestCoalescingFilter*>(elem->channel_data);
+    chand->~RequestCoalescingFilter();
+  }
+
+ private:
+  class CoalescedRequest;
+
+  static MemoryAllocator CreateMemoryAllocator(const ChannelArgs& args) {
+    ResourceQuotaRefPtr quota = args.GetObjectRef<ResourceQuota>();
+    if (quota == nullptr) quota = ResourceQuota::Default();
+    return quota->memory_quota()->CreateMemoryAllocator("request_coalescing");
+  }
+
+  explicit RequestCoalescingFilter(const ChannelArgs& args)
+      : service_config_parser_index_(
+            internal::RequestCoalescingServiceConfigParser::ParserIndex()),
+        memory_allocator_(CreateMemoryAllocator(args)) {}
+
+  // Returns the in-flight request for key, creating it if there is none, in
+  // which case *is_leader is set to true.
+  RefCountedPtr<CoalescedRequest> Join(std::string key, bool* is_leader);
+  // Stops new calls from joining request.
+  void Retire(CoalescedRequest* request);
+
+  const size_t service_config_parser_index_;
+  MemoryAllocator memory_allocator_;
+  Mutex mu_;
+  absl::flat_hash_map<std::string, RefCountedPtr<CoalescedRequest>> in_flight_
+      ABSL_GUARDED_BY(mu_);
+};
+
+//
+// RequestCoalescingFilter::CoalescedRequest
+//
+
+// The response to one in-flight request, shared by its leader and followers.
+// The response is written by the leader only, and read by followers only once
+// it has been published.
+class RequestCoalescingFilter::CoalescedRequest
+    : public RefCounted<CoalescedRequest> {
+ public:
+  CoalescedRequest(std::string key, MemoryAllocator* allocator)
+      : key_(std::move(key)),
+        arena_(MakeScopedArena(1024, allocator)),
+        initial_metadata_(arena_.get()),
+        trailing_metadata_(arena_.get()) {}
+
+  const std::string& key() const { return key_; }
+
+  // Leader side.
+  void SetInitialMetadata(const grpc_metadata_batch& md) {
+    initial_metadata_ = md.Copy(arena_.get());
+  }
+  void SetMessage(const SliceBuffer& message, uint32_t flags) {
+    message_ = message.Copy();
+    message_flags_ = flags;
+  }
+  // Makes the response visible to followers and returns the followers that
+  // were waiting for it; their held batches now belong to the caller, and
+  // RemoveWaiter() returns false for them from here on.
+  std::vector<CallData*> Publish(grpc_error_handle error,
+                                 const grpc_metadata_batch* trailing_metadata) {
+    error_ = std::move(error);
+    if (trailing_metadata != nullptr) {
+      trailing_metadata_ = trailing_metadata->Copy(arena_.get());
+    }
+    absl::flat_hash_set<CallData*> waiters;
+    {
+      MutexLock lock(&mu_);
+      published_ = true;
+      waiters = std::exchange(waiters_, {});
+    }
+    return std::vector<CallData*>(waiters.begin(), waiters.end());
+  }
+
+  // Follower side.
+  // Queues batch on calld until the response is published. Returns false,
+  // leaving batch untouched, if it already has been.
+  bool HoldUntilPublished(CallData* calld,
+                          grpc_transport_stream_op_batch* batch);
+  // Returns true if calld was still waiting, in which case its held batches
+  // are no longer going to be completed by the leader.
+  bool RemoveWaiter(CallData* calld) {
+    MutexLock lock(&mu_);
+    return waiters_.erase(calld) > 0;
+  }
+  // Fills in batch from the published response and queues its callbacks.
+  void CompleteBatch(grpc_transport_stream_op_batch* batch, Arena* arena,
+                     CallCombinerClosureList* closures) const;
+
+ private:
+  const std::string key_;
+  ScopedArenaPtr arena_;
+  grpc_metadata_batch initial_metadata_;
+  absl::optional<SliceBuffer> message_;
+  uint32_t message_flags_ = 0;
+  grpc_metadata_batch trailing_metadata_;
+  grpc_error_handle error_;
+  Mutex mu_;
+  bool published_ ABSL_GUARDED_BY(mu_) = false;
+  absl::flat_hash_set<CallData*> waiters_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// RequestCoalescingFilter::CallData
+//
+
+class RequestCoalescingFilter::CallData {
+ public:
+  static grpc_error_handle Init(grpc_call_element* elem,
+                                const grpc_call_element_args* args) {
+    new (elem->call_data) CallData(elem, *args);
+    return absl::OkStatus();
+  }
+
+  static void Destroy(grpc_call_element* elem,
+                      const grpc_call_final_info* /*final_info*/,
+                      grpc_closure* /*then_schedule_closure*/) {
+    auto* calld = static_cast<CallData*>(elem->call_data);
+    calld->~CallData();
+  }
+
+  static void StartTransportStreamOpBatch(
+      grpc_call_element* elem, grpc_transport_stream_op_batch* batch);
+
+ private:
+  friend class RequestCoalescingFilter::CoalescedRequest;
+
+  enum class Role { kUndecided, kPassThrough, kLeader, kFollower };
+
+  CallData(grpc_call_element* elem, const grpc_call_element_args& args);
+  ~CallData();
+
+  bool CoalescingEnabled(const grpc_call_context_element* context) const;
+  void DecideRole(grpc_transport_stream_op_batch* batch);
+
+  // Leader side.
+  void StartLeaderBatch(grpc_transport_stream_op_batch* batch);
+  static void RecvInitialMetadataReady(void* arg, grpc_error_handle error);
+  static void RecvMessageReady(void* arg, grpc_error_handle error);
+  static void RecvTrailingMetadataReady(void* arg, grpc_error_handle error);
+  void PublishResponse(grpc_error_handle error,
+                       const grpc_metadata_batch* trailing_metadata);
+
+  // Follower side.
+  void StartFollowerBatch(grpc_transport_stream_op_batch* batch);
+  // Completes the batches held while waiting for the leader. Called from the
+  // leader's call combiner, so the closures are started in ours.
+  void CompleteHeldBatches();
+
+  grpc_call_element* elem_;
+  RequestCoalescingFilter* chand_;
+  CallCombiner* call_combiner_;
+  Arena* arena_;
+  Slice path_;
+  bool coalescing_enabled_;
+  Role role_ = Role::kUndecided;
+  RefCountedPtr<CoalescedRequest> request_;
+
+  // Leader state.
+  bool cancelled_by_application_ = false;
+  bool published_ = false;
+  grpc_metadata_batch* recv_initial_metadata_ = nullptr;
+  grpc_closure* original_recv_initial_metadata_ready_ = nullptr;
+  grpc_closure recv_initial_metadata_ready_;
+  absl::optional<SliceBuffer>* recv_message_ = nullptr;
+  uint32_t* recv_message_flags_ = nullptr;
+  grpc_closure* original_recv_message_ready_ = nullptr;
+  grpc_closure recv_message_ready_;
+  grpc_metadata_batch* recv_trailing_metadata_ = nullptr;
+  grpc_closure* original_recv_trailing_metadata_ready_ = nullptr;
+  grpc_closure recv_trailing_metadata_ready_;
+
+  // Follower state.
+  grpc_error_handle cancel_error_;
+  // Guarded by request_'s lock while this call is one of its waiters.
+  std::vector<grpc_transport_stream_op_batch*> held_batches_;
+};
+
+//
+// RequestCoalescingFilter
+//
+
+RefCountedPtr<RequestCoalescingFilter::CoalescedRequest>
+RequestCoalescingFilter::Join(std::string key, bool* is_leader) {
+  MutexLock lock(&mu_);
+  auto it = in_flight_.find(key);
+  if (it != in_flight_.end()) {
+    *is_leader = false;
+    return it->second;
+  }
+  *is_leader = true;
+  auto request = MakeRefCounted<CoalescedRequest>(key, &memory_allocator_);
+  in_flight_.emplace(std::move(key), request);
+  return request;
+}
+
+void RequestCoalescingFilter::Retire(CoalescedRequest* request) {
+  MutexLock lock(&mu_);
+  auto it = in_flight_.find(request->key());
+  if (it != in_flight_.end() && it->second.get() == request) {
+    in_flight_.erase(it);
+  }
+}
+
+//
+// RequestCoalescingFilter::CoalescedRequest
+//
+
+bool RequestCoalescingFilter::CoalescedRequest::HoldUntilPublished(
+    CallData* calld, grpc_transport_stream_op_batch* batch) {
+  MutexLock lock(&mu_);
+  if (published_) return false;
+  calld->held_batches_.push_back(batch);
+  waiters_.insert(calld);
+  return true;
+}
+
+void RequestCoalescingFilter::CoalescedRequest::CompleteBatch(
+    grpc_transport_stream_op_batch* batch, Arena* arena,
+    CallCombinerClosureList* closures) const {
+  if (batch->send_trailing_metadata &&
+      batch->payload->send_trailing_metadata.sent != nullptr) {
+    *batch->payload->send_trailing_metadata.sent = true;
+  }
+  if (!error_.ok()) {
+    grpc_transport_stream_op_batch_queue_finish_with_failure(batch, error_,
+                                                             closures);
+    return;
+  }
+  if (batch->recv_initial_metadata) {
+    auto& payload = batch->payload->recv_initial_metadata;
+    *payload.recv_initial_metadata = initial_metadata_.Copy(arena);
+    if (payload.trailing_metadata_available != nullptr) {
+      *payload.trailing_metadata_available = false;
+    }
+    closures->Add(payload.recv_initial_metadata_ready, absl::OkStatus(),
+                  "coalesced recv_initial_metadata_ready");
+  }
+  if (batch->recv_message) {
+    auto& payload = batch->payload->recv_message;
+    if (message_.has_value()) {
+      payload.recv_message->emplace(message_->Copy());
+    } else {
+      payload.recv_message->reset();
+    }
+    if (payload.flags != nullptr) *payload.flags = message_flags_;
+    if (payload.call_failed_before_recv_message != nullptr) {
+      *payload.call_failed_before_recv_message = false;
+    }
+    closures->Add(payload.recv_message_ready, absl::OkStatus(),
+                  "coalesced recv_message_ready");
+  }
+  if (batch->recv_trailing_metadata) {
+    auto& payload = batch->payload->recv_trailing_metadata;
+    *payload.recv_trailing_metadata = trailing_metadata_.Copy(arena);
+    closures->Add(payload.recv_trailing_metadata_ready, absl::OkStatus(),
+                  "coalesced recv_trailing_metadata_ready");
+  }
+  if (batch->on_complete != nullptr) {
+    closures->Add(batch->on_complete, absl::OkStatus(),
+                  "coalesced on_complete");
+  }
+}
+
+//
+// RequestCoalescingFilter::CallData
+//
+
+RequestCoalescingFilter::CallData::CallData(grpc_call_element* elem,
+                                            const grpc_call_element_args& args)
+    : elem_(elem),
+      chand_(static_cast<RequestCoalescingFilter*>(elem->channel_data)),
+      call_combiner_(args.call_combiner),
+      arena_(args.arena),
+      path_(CSliceRef(args.path)),
+      coalescing_enabled_(CoalescingEnabled(args.context)) {
+  GRPC_CLOSURE_INIT(&recv_initial_metadata_ready_, RecvInitialMetadataReady,
+                    this, grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&recv_message_ready_, RecvMessageReady, this,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&recv_trailing_metadata_ready_, RecvTrailingMetadataReady,
+                    this, grpc_schedule_on_exec_ctx);
+}
+
+RequestCoalescingFilter::CallData::~CallData() {
+  // A leader that goes away without a response must not strand its
+  // followers.
+  if (role_ == Role::kLeader && !published_) {
+    PublishResponse(absl::UnavailableError("coalesced call was destroyed"),
+                    nullptr);
+  } else if (role_ == Role::kFollower) {
+    request_->RemoveWaiter(this);
+  }
+}
+
+bool RequestCoalescingFilter::CallData::CoalescingEnabled(
+    const grpc_call_context_element* context) const {
+  if (context == nullptr) return false;
+  auto* svc_cfg_call_data = static_cast<ServiceConfigCallData*>(
+      context[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+  if (svc_cfg_call_data == nullptr) return false;
+  auto* method_config =
+      static_cast<const internal::RequestCoalescingMethodConfig*>(
+          svc_cfg_call_data->GetMethodParsedConfig(
+              chand_->service_config_parser_index_));
+  return method_config != nullptr &&
+         method_config->coalesce_identical_requests();
+}
+
+void RequestCoalescingFilter::CallData::StartTransportStreamOpBatch(
+    grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
+  auto* calld = static_cast<CallData*>(elem->call_data);
+  if (calld->role_ == Role::kUndecided) calld->DecideRole(batch);
+  switch (calld->role_) {
+    case Role::kLeader:
+      calld->StartLeaderBatch(batch);
+      break;
+    case Role::kFollower:
+      calld->StartFollowerBatch(batch);
+      break;
+    default:
+      grpc_call_next_op(elem, batch);
+  }
+}
+
+void RequestCoalescingFilter::CallData::DecideRole(
+    grpc_transport_stream_op_batch* batch) {
+  role_ = Role::kPassThrough;
+  if (!coalescing_enabled_ || batch->cancel_stream ||
+      !batch->send_initial_metadata || !batch->send_message ||
+      !batch->send_trailing_metadata) {
+    return;
+  }
+  // A call with call credentials acts on behalf of whoever those credentials
+  // name, and its auth metadata is only added further down the stack, so it
+  // must never share a response with another call.
+  if (batch->payload->context != nullptr &&
+      batch->payload->context[GRPC_CONTEXT_SECURITY].value != nullptr) {
+    return;
+  }
+  // Calls only match if they send the same request metadata, apart from the
+  // deadline. Entries are length-prefixed since binary values may hold any
+  // byte.
+  std::string key(path_.as_string_view());
+  key.push_back('\0');
+  batch->payload->send_initial_metadata.send_initial_metadata->Log(
+      [&key](absl::string_view name, absl::string_view value) {
+        if (name == GrpcTimeoutMetadata::key() ||
+            name == HttpPathMetadata::key()) {
+          return;
+        }
+        absl::StrAppend(&key, name.size(), ":", name, value.size(), ":",
+                        value);
+      });
+  key.push_back('\0');
+  absl::StrAppend(&key,
+                  batch->payload->send_message.send_message->JoinIntoString());
+  bool is_leader;
+  request_ = chand_->Join(std::move(key), &is_leader);
+  role_ = is_leader ? Role::kLeader : Role::kFollower;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_request_coalescing_trace)) {
+    gpr_log(GPR_INFO, "chand=%p calld=%p: %s coalesced request %p", chand_,
+            this, is_leader ? "leading" : "following", request_.get());
+  }
+}
+
+void RequestCoalescingFilter::CallData::StartLeaderBatch(
+    grpc_transport_stream_op_batch* batch) {
+  if (batch->cancel_stream) cancelled_by_application_ = true;
+  if (batch->recv_initial_metadata) {
+    auto& payload = batch->payload->recv_initial_metadata;
+    recv_initial_metadata_ = payload.recv_initial_metadata;
+    original_recv_initial_metadata_ready_ = payload.recv_initial_metadata_ready;
+    payload.recv_initial_metadata_ready = &recv_initial_metadata_ready_;
+  }
+  if (batch->recv_message) {
+    auto& payload = batch->payload->recv_message;
+    recv_message_ = payload.recv_message;
+    recv_message_flags_ = payload.flags;
+    original_recv_message_ready_ = payload.recv_message_ready;
+    payload.recv_message_ready = &recv_message_ready_;
+  }
+  if (batch->recv_trailing_metadata) {
+    auto& payload = batch->payload->recv_trailing_metadata;
+    recv_trailing_metadata_ = payload.recv_trailing_metadata;
+    original_recv_trailing_metadata_ready_ =
+        payload.recv_trailing_metadata_ready;
+    payload.recv_trailing_metadata_ready = &recv_trailing_metadata_ready_;
+  }
+  grpc_call_next_op(elem_, batch);
+}
+
+void RequestCoalescingFilter::CallData::RecvInitialMetadataReady(
+    void* arg, grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  if (error.ok()) {
+    calld->request_->SetInitialMetadata(*calld->recv_initial_metadata_);
+  }
+  Closure::Run(DEBUG_LOCATION, calld->original_recv_initial_metadata_ready_,
+               error);
+}
+
+void RequestCoalescingFilter::CallData::RecvMessageReady(
+    void* arg, grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  if (error.ok() && calld->recv_message_->has_value()) {
+    const uint32_t flags = calld->recv_message_flags_ == nullptr
+                               ? 0
+                               : *calld->recv_message_flags_;
+    calld->request_->SetMessage(**calld->recv_message_, flags);
+  }
+  Closure::Run(DEBUG_LOCATION, calld->original_recv_message_ready_, error);
+}
+
+void RequestCoalescingFilter::CallData::RecvTrailingMetadataReady(
+    void* arg, grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  calld->PublishResponse(error, calld->recv_trailing_metadata_);
+  Closure::Run(DEBUG_LOCATION, calld->original_recv_trailing_metadata_ready_,
+               error);
+}
+
+void RequestCoalescingFilter::CallData::PublishResponse(
+    grpc_error_handle error, const grpc_metadata_batch* trailing_metadata) {
+  if (published_) return;
+  published_ = true;
+  chand_->Retire(request_.get());
+  if (cancelled_by_application_) {
+    error = absl::UnavailableError("coalesced call was cancelled");
+    trailing_metadata = nullptr;
+  }
+  std::vector<CallData*> followers =
+      request_->Publish(std::move(error), trailing_metadata);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_request_coalescing_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: publishing coalesced request %p to %" PRIuPTR
+            " waiting followers",
+            chand_, this, request_.get(), followers.size());
+  }
+  for (CallData* follower : followers) follower->CompleteHeldBatches();
+}
+
+void RequestCoalescingFilter::CallData::StartFollowerBatch(
+    grpc_transport_stream_op_batch* batch) {
+  if (batch->cancel_stream) {
+    cancel_error_ = batch->payload->cancel_stream.cancel_error;
+    CallCombinerClosureList closures;
+    if (request_->RemoveWaiter(this)) {
+      for (grpc_transport_stream_op_batch* held : held_batches_) {
+        grpc_transport_stream_op_batch_queue_finish_with_failure(
+            held, cancel_error_, &closures);
+      }
+      held_batches_.clear();
+    }
+    closures.RunClosuresWithoutYielding(call_combiner_);
+    // Nothing of ours was sent, but the cancellation still has to be
+    // acknowledged by the rest of the stack.
+    grpc_call_next_op(elem_, batch);
+    return;
+  }
+  if (!cancel_error_.ok()) {
+    grpc_transport_stream_op_batch_finish_with_failure(batch, cancel_error_,
+                                                       call_combiner_);
+    return;
+  }
+  if (request_->HoldUntilPublished(this, batch)) {
+    GRPC_CALL_COMBINER_STOP(call_combiner_, "waiting for coalesced response");
+    return;
+  }
+  CallCombinerClosureList closures;
+  request_->CompleteBatch(batch, arena_, &closures);
+  closures.RunClosures(call_combiner_);
+}
+
+void RequestCoalescingFilter::CallData::CompleteHeldBatches() {
+  CallCombinerClosureList closures;
+  for (grpc_transport_stream_op_batch* batch : held_batches_) {
+    request_->CompleteBatch(batch, arena_, &closures);
+  }
+  held_batches_.clear();
+  closures.RunClosuresWithoutYielding(call_combiner_);
+}
+
+}  // namespace
+
+const grpc_channel_filter kRequestCoalescingFilterVtable = {
+    RequestCoalescingFilter::CallData::StartTransportStreamOpBatch,
+    nullptr,
+    grpc_channel_next_op,
+    sizeof(RequestCoalescingFilter::CallData),
+    RequestCoalescingFilter::CallData::Init,
+    grpc_call_stack_ignore_set_pollset_or_pollset_set,
+    RequestCoalescingFilter::CallData::Destroy,
+    sizeof(RequestCoalescingFilter),
+    RequestCoalescingFilter::Init,
+    grpc_channel_stack_no_post_init,
+    RequestCoalescingFilter::Destroy,
+    grpc_channel_next_get_info,
+    "request_coalescing",
+};
+
+}  // namespace grpc_core
@@ -0,0 +1,34 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/channel_stack.h"
+
+namespace grpc_core {
+
+// Dynamic filter that lets identical in-flight unary calls share one
+// response. Enabled per method by "coalesceIdenticalRequests" in the service
+// config.
+extern const grpc_channel_filter kRequestCoalescingFilterVtable;
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_FILTER_H
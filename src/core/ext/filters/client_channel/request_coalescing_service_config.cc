@@ -0,0 +1,96 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/request_coalescing_service_config.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace grpc_core {
+namespace internal {
+
+//
+// RequestCoalescingMethodConfig
+//
+
+const JsonLoaderInterface* RequestCoalescingMethodConfig::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<RequestCoalescingMethodConfig>()
+          .OptionalField(
+              "coalesceIdenticalRequests",
+              &RequestCoalescingMethodConfig::coalesce_identical_requests_)
+          .Finish();
+  return loader;
+}
+
+//
+// RequestCoalescingServiceConfigParser
+//
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+RequestCoalescingServiceConfigParser::ParseGlobalParams(
+    const ChannelArgs& /*args*/, const Json& json,
+    ValidationErrors* /*errors*/) {
+  // Malformed method configs are reported by ParsePerMethodParams(), so this
+  // only looks for a method that enables coalescing.
+  if (json.type() != Json::Type::OBJECT) return nullptr;
+  auto it = json.object_value().find("methodConfig");
+  if (it == json.object_value().end() ||
+      it->second.type() != Json::Type::ARRAY) {
+    return nullptr;
+  }
+  for (const Json& method_config : it->second.array_value()) {
+    if (method_config.type() != Json::Type::OBJECT) continue;
+    const Json::Object& fields = method_config.object_value();
+    auto field = fields.find("coalesceIdenticalRequests");
+    if (field != fields.end() &&
+        field->second.type() == Json::Type::JSON_TRUE) {
+      return std::make_unique<RequestCoalescingGlobalConfig>();
+    }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+RequestCoalescingServiceConfigParser::ParsePerMethodParams(
+    const ChannelArgs& /*args*/, const Json& json, ValidationErrors* errors) {
+  auto config =
+      LoadFromJson<std::unique_ptr<RequestCoalescingMethodConfig>>(
+          json, JsonArgs(), errors);
+  // Don't bother storing a config for methods that leave coalescing off.
+  if (config == nullptr || !config->coalesce_identical_requests()) {
+    return nullptr;
+  }
+  return config;
+}
+
+size_t RequestCoalescingServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+void RequestCoalescingServiceConfigParser::Register(
+    CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<RequestCoalescingServiceConfigParser>());
+}
+
+}  // namespace internal
+}  // namespace grpc_core
@@ -0,0 +1,82 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_SERVICE_CONFIG_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_SERVICE_CONFIG_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/service_config/service_config_parser.h"
+
+namespace grpc_core {
+namespace internal {
+
+// Per-method config for the request coalescing filter. Only methods that set
+// "coalesceIdenticalRequests" to true get a parsed config.
+class RequestCoalescingMethodConfig : public ServiceConfigParser::ParsedConfig {
+ public:
+  bool coalesce_identical_requests() const {
+    return coalesce_identical_requests_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+
+ private:
+  bool coalesce_identical_requests_ = false;
+};
+
+// Global config for the request coalescing filter. It is present only if at
+// least one method enables coalescing, and is what the client channel checks
+// to decide whether to add the filter at all.
+class RequestCoalescingGlobalConfig
+    : public ServiceConfigParser::ParsedConfig {};
+
+class RequestCoalescingServiceConfigParser
+    : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParseGlobalParams(
+      const ChannelArgs& /*args*/, const Json& json,
+      ValidationErrors* /*errors*/) override;
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& /*args*/, const Json& json,
+      ValidationErrors* errors) override;
+
+  static size_t ParserIndex();
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "request_coalescing"; }
+};
+
+}  // namespace internal
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_REQUEST_COALESCING_SERVICE_CONFIG_H
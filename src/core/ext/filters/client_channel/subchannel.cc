@@ -57,6 +57,7 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/handshaker/proxy_mapper_registry.h"
+#include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -65,6 +66,7 @@
 #include "src/core/lib/surface/init_internally.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/transport.h"
 
 // Backoff parameters.
 #define GRPC_SUBCHANNEL_INITIAL_CONNECT_BACKOFF_SECONDS 1
@@ -128,6 +130,13 @@ void ConnectedSubchannel::Ping(grpc_closure* on_initiate,
   elem->filter->start_transport_op(elem, op);
 }
 
+void ConnectedSubchannel::Disconnect(grpc_error_handle error) {
+  grpc_transport_op* op = grpc_make_transport_op(nullptr);
+  op->disconnect_with_error = error;
+  grpc_channel_element* elem = grpc_channel_stack_element(channel_stack_, 0);
+  elem->filter->start_transport_op(elem, op);
+}
+
 size_t ConnectedSubchannel::GetInitialCallSizeEstimate() const {
   return GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(SubchannelCall)) +
          channel_stack_->call_stack_size;
@@ -300,8 +309,10 @@ class Subchannel::ConnectedSubchannelStateWatcher
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connected_subchannel)
+      : subchannel_(std::move(c)),
+        connected_subchannel_(connected_subchannel) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -313,33 +324,9 @@ class Subchannel::ConnectedSubchannelStateWatcher
     Subchannel* c = subchannel_.get();
     {
       MutexLock lock(&c->mu_);
-      // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
-      //
-      // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
-      // upon connection close.  So if the server gracefully shuts down,
-      // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
-      // will see only SHUTDOWN.  Either way, we react to the first one we
-      // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
       if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
           new_state == GRPC_CHANNEL_SHUTDOWN) {
-        if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
-          gpr_log(GPR_INFO,
-                  "subchannel %p %s: Connected subchannel %p reports %s: %s", c,
-                  c->key_.ToString().c_str(), c->connected_subchannel_.get(),
-                  ConnectivityStateName(new_state), status.ToString().c_str());
-        }
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+        c->OnConnectionFailedLocked(connected_subchannel_, new_state, status);
       }
     }
     // Drain any connectivity state notifications after releasing the mutex.
@@ -347,6 +334,8 @@ class Subchannel::ConnectedSubchannelStateWatcher
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // Using pointer value only, no ref held -- do not dereference!
+  ConnectedSubchannel* connected_subchannel_;
 };
 
 //
@@ -445,6 +434,26 @@ class Subchannel::HealthWatcherMap::HealthWatcher
     }
   }
 
+  void NotifyKeepaliveThrottlingLocked(const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+    // Only a TRANSIENT_FAILURE status reaches the LB policy, so keep that
+    // one and just add the keepalive info to it.
+    absl::Status notify_status = status;
+    if (state_ == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      notify_status = status_;
+      notify_status.SetPayload(kKeepaliveThrottlingKey,
+                               *status.GetPayload(kKeepaliveThrottlingKey));
+    }
+    watcher_list_.NotifyLocked(state_, notify_status);
+  }
+
+  void RestartHealthCheckingLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+    if (health_check_client_ == nullptr) return;
+    health_check_client_.reset();
+    StartHealthCheckingLocked();
+  }
+
   void Orphan() override {
     watcher_list_.Clear();
     health_check_client_.reset();
@@ -525,6 +534,19 @@ void Subchannel::HealthWatcherMap::NotifyLocked(grpc_connectivity_state state,
   }
 }
 
+void Subchannel::HealthWatcherMap::NotifyKeepaliveThrottlingLocked(
+    const absl::Status& status) {
+  for (const auto& p : map_) {
+    p.second->NotifyKeepaliveThrottlingLocked(status);
+  }
+}
+
+void Subchannel::HealthWatcherMap::RestartHealthCheckingLocked() {
+  for (const auto& p : map_) {
+    p.second->RestartHealthCheckingLocked();
+  }
+}
+
 grpc_connectivity_state
 Subchannel::HealthWatcherMap::CheckConnectivityStateLocked(
     Subchannel* subchannel, const std::string& health_check_service_name) {
@@ -599,6 +621,11 @@ Subchannel::Subchannel(SubchannelKey key,
       pollset_set_(grpc_pollset_set_create()),
       connector_(std::move(connector)),
       watcher_list_(this),
+      max_connections_(std::max(
+          1, args_.GetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS).value_or(1))),
+      calls_per_connection_(std::max(
+          1, args_.GetInt(GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION)
+                 .value_or(100))),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
@@ -613,6 +640,9 @@ Subchannel::Subchannel(SubchannelKey key,
   global_stats().IncrementClientSubchannelsCreated();
   GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
                     grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&on_pooled_connecting_finished_,
+                    OnPooledConnectingFinished, this,
+                    grpc_schedule_on_exec_ctx);
   // Check proxy mapper to determine address to connect to and channel
   // args to use.
   address_for_connect_ = CoreConfiguration::Get()
@@ -688,6 +718,29 @@ channelz::SubchannelNode* Subchannel::channelz_node() {
   return channelz_node_.get();
 }
 
+RefCountedPtr<ConnectedSubchannel>
+Subchannel::PickConnectedSubchannelForCall() {
+  MutexLock lock(&mu_);
+  if (connected_subchannel_ == nullptr) return nullptr;
+  ConnectedSubchannel* least_loaded = connected_subchannel_.get();
+  if (max_connections_ > 1) {
+    size_t min_active_calls = least_loaded->active_calls();
+    for (const PooledConnection& pooled_connection : pooled_connections_) {
+      const size_t active_calls =
+          pooled_connection.connected_subchannel->active_calls();
+      if (active_calls < min_active_calls) {
+        least_loaded = pooled_connection.connected_subchannel.get();
+        min_active_calls = active_calls;
+      }
+    }
+    MaybeStartPooledConnectionLocked(min_active_calls);
+  }
+  // Count the call now rather than when its SubchannelCall is created, so
+  // that a burst of picks does not all land on the same connection.
+  least_loaded->CallStarted();
+  return least_loaded->Ref();
+}
+
 void Subchannel::WatchConnectivityState(
     const absl::optional<std::string>& health_check_service_name,
     RefCountedPtr<ConnectivityStateWatcherInterface> watcher) {
@@ -777,7 +830,9 @@ void Subchannel::Orphan() {
     GPR_ASSERT(!shutdown_);
     shutdown_ = true;
     connector_.reset();
+    event_engine_->Cancel(warmup_timer_handle_);
     connected_subchannel_.reset();
+    pooled_connections_.clear();
     health_watcher_map_.ShutdownLocked();
   }
   // Drain any connectivity state notifications after releasing the mutex.
@@ -854,13 +909,20 @@ void Subchannel::StartConnectingLocked() {
   // Set next attempt time.
   const Timestamp min_deadline = min_connect_timeout_ + Timestamp::Now();
   next_attempt_time_ = backoff_.NextAttemptTime();
+  connect_deadline_ = std::max(next_attempt_time_, min_deadline);
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // If a pooled connection attempt is still in progress, the connector is
+  // busy, so use that attempt's connection as the main one.
+  if (connecting_pooled_connection_) {
+    pooled_attempt_is_main_ = true;
+    return;
+  }
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
   args.interested_parties = pollset_set_;
-  args.deadline = std::max(next_attempt_time_, min_deadline);
+  args.deadline = connect_deadline_;
   args.channel_args = args_;
   WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
@@ -884,79 +946,363 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
   }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
+  if (connecting_result_.transport == nullptr ||
+      !PublishTransportLocked(&connecting_result_)) {
+    OnConnectAttemptFailedLocked(error);
+  }
+}
+
+void Subchannel::OnConnectAttemptFailedLocked(grpc_error_handle error) {
   // Note that if the connection attempt took longer than the backoff
   // time, then the timer will fire immediately, and we will quickly
   // transition back to IDLE.
-  if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
-    const Duration time_until_next_attempt =
-        next_attempt_time_ - Timestamp::Now();
-    gpr_log(GPR_INFO,
-            "subchannel %p %s: connect failed (%s), backing off for %" PRId64
-            " ms",
-            this, key_.ToString().c_str(), StatusToString(error).c_str(),
-            time_until_next_attempt.millis());
-    SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE,
-                               grpc_error_to_absl_status(error));
-    retry_timer_handle_ = event_engine_->RunAfter(
-        time_until_next_attempt,
-        [self = WeakRef(DEBUG_LOCATION, "RetryTimer")]() mutable {
+  const Duration time_until_next_attempt =
+      next_attempt_time_ - Timestamp::Now();
+  gpr_log(GPR_INFO,
+          "subchannel %p %s: connect failed (%s), backing off for %" PRId64
+          " ms",
+          this, key_.ToString().c_str(), StatusToString(error).c_str(),
+          time_until_next_attempt.millis());
+  SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                             grpc_error_to_absl_status(error));
+  retry_timer_handle_ = event_engine_->RunAfter(
+      time_until_next_attempt,
+      [self = WeakRef(DEBUG_LOCATION, "RetryTimer")]() mutable {
+        {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          self->OnRetryTimer();
+          // Subchannel deletion might require an active ExecCtx. So if
+          // self.reset() is not called here, the WeakRefCountedPtr destructor
+          // may run after the ExecCtx declared in the callback is destroyed.
+          // Since subchannel may get destroyed when the WeakRefCountedPtr
+          // destructor runs, it may not have an active ExecCtx - thus leading
+          // to crashes.
+          self.reset();
+        }
+      });
+}
+
+bool Subchannel::PublishTransportLocked(SubchannelConnector::Result* result) {
+  RefCountedPtr<channelz::SocketNode> socket;
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+      BuildConnectedSubchannelLocked(result, &socket);
+  if (connected_subchannel == nullptr) return false;
+  // Publish.
+  connected_subchannel_ = std::move(connected_subchannel);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
+            key_.ToString().c_str(), connected_subchannel_.get());
+  }
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(std::move(socket));
+  }
+  StartWatchingConnectionLocked(connected_subchannel_.get());
+  // If configured, stay CONNECTING until a ping has made a round trip on the
+  // new connection, but no longer than the connection attempt's deadline.
+  if (args_.GetBool(GRPC_ARG_SUBCHANNEL_WARMUP_PING).value_or(false)) {
+    warmup_timer_handle_ = event_engine_->RunAfter(
+        connect_deadline_ - Timestamp::Now(),
+        [self = WeakRef(DEBUG_LOCATION, "WarmupTimer"),
+         connected_subchannel = connected_subchannel_]() mutable {
           {
             ApplicationCallbackExecCtx callback_exec_ctx;
             ExecCtx exec_ctx;
-            self->OnRetryTimer();
-            // Subchannel deletion might require an active ExecCtx. So if
-            // self.reset() is not called here, the WeakRefCountedPtr destructor
-            // may run after the ExecCtx declared in the callback is destroyed.
-            // Since subchannel may get destroyed when the WeakRefCountedPtr
-            // destructor runs, it may not have an active ExecCtx - thus leading
-            // to crashes.
+            {
+              MutexLock lock(&self->mu_);
+              self->OnWarmupPingDoneLocked(
+                  connected_subchannel.get(),
+                  GRPC_ERROR_CREATE("warm-up ping not acked before deadline"));
+            }
+            // Drain any connectivity state notifications after releasing the
+            // mutex.
+            self->work_serializer_.DrainQueue();
+            // As with the retry timer, release the refs while the ExecCtx is
+            // still active.
+            connected_subchannel.reset();
             self.reset();
           }
         });
+    connected_subchannel_->Ping(
+        nullptr,
+        NewClosure([self = WeakRef(DEBUG_LOCATION, "WarmupPing"),
+                    connected_subchannel = connected_subchannel_](
+                       grpc_error_handle error) {
+          {
+            MutexLock lock(&self->mu_);
+            self->OnWarmupPingDoneLocked(connected_subchannel.get(), error);
+          }
+          // Drain any connectivity state notifications after releasing the
+          // mutex.
+          self->work_serializer_.DrainQueue();
+        }));
+    return true;
   }
+  // Report initial state.
+  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  return true;
 }
 
-bool Subchannel::PublishTransportLocked() {
+RefCountedPtr<ConnectedSubchannel> Subchannel::BuildConnectedSubchannelLocked(
+    SubchannelConnector::Result* result,
+    RefCountedPtr<channelz::SocketNode>* socket) {
   // Construct channel stack.
   ChannelStackBuilderImpl builder("subchannel", GRPC_CLIENT_SUBCHANNEL,
-                                  connecting_result_.channel_args);
-  builder.SetTransport(connecting_result_.transport);
+                                  result->channel_args);
+  builder.SetTransport(result->transport);
   if (!CoreConfiguration::Get().channel_init().CreateStack(&builder)) {
-    return false;
+    return nullptr;
   }
   absl::StatusOr<RefCountedPtr<grpc_channel_stack>> stk = builder.Build();
   if (!stk.ok()) {
     auto error = absl_status_to_grpc_error(stk.status());
-    connecting_result_.Reset();
+    result->Reset();
     gpr_log(GPR_ERROR,
             "subchannel %p %s: error initializing subchannel stack: %s", this,
             key_.ToString().c_str(), StatusToString(error).c_str());
-    return false;
+    return nullptr;
   }
   // Release the ownership since it is now owned by the connected filter in the
   // channel stack (published).
-  connecting_result_.transport = nullptr;
-  RefCountedPtr<channelz::SocketNode> socket =
-      std::move(connecting_result_.socket_node);
-  connecting_result_.Reset();
-  if (shutdown_) return false;
-  // Publish.
-  connected_subchannel_.reset(
-      new ConnectedSubchannel(stk->release(), args_, channelz_node_));
+  result->transport = nullptr;
+  *socket = std::move(result->socket_node);
+  result->Reset();
+  if (shutdown_) return nullptr;
+  return MakeRefCounted<ConnectedSubchannel>(stk->release(), args_,
+                                             channelz_node_);
+}
+
+void Subchannel::StartWatchingConnectionLocked(
+    ConnectedSubchannel* connected_subchannel) {
+  connected_subchannel->StartWatch(
+      pollset_set_,
+      MakeOrphanable<ConnectedSubchannelStateWatcher>(
+          WeakRef(DEBUG_LOCATION, "state_watcher"), connected_subchannel));
+}
+
+void Subchannel::OnConnectionFailedLocked(
+    ConnectedSubchannel* connected_subchannel,
+    grpc_connectivity_state new_state, const absl::Status& status) {
+  // A pooled connection failing only shrinks the pool.
+  for (auto it = pooled_connections_.begin(); it != pooled_connections_.end();
+       ++it) {
+    if (it->connected_subchannel.get() != connected_subchannel) continue;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+      gpr_log(GPR_INFO,
+              "subchannel %p %s: pooled connected subchannel %p reports %s: %s",
+              this, key_.ToString().c_str(), connected_subchannel,
+              ConnectivityStateName(new_state), status.ToString().c_str());
+    }
+    if (channelz_node_ != nullptr && it->socket != nullptr) {
+      channelz_node_->RemovePooledChildSocket(it->socket->uuid());
+    }
+    RefCountedPtr<ConnectedSubchannel> lost =
+        std::move(it->connected_subchannel);
+    pooled_connections_.erase(it);
+    PropagateKeepaliveThrottlingLocked(status);
+    NotifyDataProducersOfConnectionLossLocked(std::move(lost));
+    return;
+  }
+  // If we're either shutting down or have already seen this connection
+  // failure (i.e., it is no longer connected_subchannel_), do nothing.
+  //
+  // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
+  // upon connection close.  So if the server gracefully shuts down,
+  // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
+  // will see only SHUTDOWN.  Either way, we react to the first one we
+  // see, ignoring anything that happens after that.
+  if (connected_subchannel_ == nullptr ||
+      connected_subchannel_.get() != connected_subchannel) {
+    return;
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
-    gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
-            key_.ToString().c_str(), connected_subchannel_.get());
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: Connected subchannel %p reports %s: %s", this,
+            key_.ToString().c_str(), connected_subchannel_.get(),
+            ConnectivityStateName(new_state), status.ToString().c_str());
   }
+  // If there is a pooled connection left, it takes over as the main
+  // connection and the subchannel stays READY.
+  if (!pooled_connections_.empty()) {
+    PooledConnection pooled_connection = std::move(pooled_connections_.back());
+    pooled_connections_.pop_back();
+    RefCountedPtr<ConnectedSubchannel> lost = std::move(connected_subchannel_);
+    connected_subchannel_ = std::move(pooled_connection.connected_subchannel);
+    if (channelz_node_ != nullptr) {
+      if (pooled_connection.socket != nullptr) {
+        channelz_node_->RemovePooledChildSocket(
+            pooled_connection.socket->uuid());
+      }
+      channelz_node_->SetChildSocket(std::move(pooled_connection.socket));
+    }
+    // The state stays READY, so health checks and producers would not
+    // otherwise notice that the connection they use is gone.
+    health_watcher_map_.RestartHealthCheckingLocked();
+    PropagateKeepaliveThrottlingLocked(status);
+    NotifyDataProducersOfConnectionLossLocked(std::move(lost));
+    return;
+  }
+  connected_subchannel_.reset();
   if (channelz_node_ != nullptr) {
-    channelz_node_->SetChildSocket(std::move(socket));
+    channelz_node_->SetChildSocket(nullptr);
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
-  // Report initial state.
-  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
-  return true;
+  // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+  // pass along the status from the transport, since it may have
+  // keepalive info attached to it that the channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to do this.
+  SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+  backoff_.Reset();
+}
+
+void Subchannel::MaybeStartPooledConnectionLocked(size_t min_active_calls) {
+  if (min_active_calls < calls_per_connection_ ||
+      pooled_connections_.size() + 1 >= max_connections_ ||
+      connecting_pooled_connection_ || state_ != GRPC_CHANNEL_READY ||
+      shutdown_) {
+    return;
+  }
+  const Timestamp now = Timestamp::Now();
+  if (now < next_pooled_connection_time_) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: all %" PRIuPTR
+            " connections have at least %" PRIuPTR
+            " calls, starting another",
+            this, key_.ToString().c_str(), pooled_connections_.size() + 1,
+            min_active_calls);
+  }
+  connecting_pooled_connection_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = now + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &pooled_connecting_result_,
+                      &on_pooled_connecting_finished_);
+}
+
+void Subchannel::OnPooledConnectingFinished(void* arg,
+                                            grpc_error_handle error) {
+  WeakRefCountedPtr<Subchannel> c(static_cast<Subchannel*>(arg));
+  {
+    MutexLock lock(&c->mu_);
+    c->OnPooledConnectingFinishedLocked(error);
+  }
+  // Drain any connectivity state notifications after releasing the mutex.
+  c->work_serializer_.DrainQueue();
+  c.reset(DEBUG_LOCATION, "Connect");
+}
+
+void Subchannel::OnPooledConnectingFinishedLocked(grpc_error_handle error) {
+  connecting_pooled_connection_ = false;
+  if (shutdown_) {
+    pooled_connecting_result_.Reset();
+    return;
+  }
+  // If the main connection was needed in the meantime, this attempt was
+  // standing in for a main connection attempt.
+  if (pooled_attempt_is_main_) {
+    pooled_attempt_is_main_ = false;
+    if (pooled_connecting_result_.transport == nullptr ||
+        !PublishTransportLocked(&pooled_connecting_result_)) {
+      OnConnectAttemptFailedLocked(error);
+    }
+    return;
+  }
+  RefCountedPtr<channelz::SocketNode> socket;
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  if (pooled_connecting_result_.transport != nullptr) {
+    connected_subchannel =
+        BuildConnectedSubchannelLocked(&pooled_connecting_result_, &socket);
+  }
+  if (connected_subchannel == nullptr) {
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: pooled connection attempt failed (%s)", this,
+            key_.ToString().c_str(), StatusToString(error).c_str());
+    pooled_connecting_result_.Reset();
+    next_pooled_connection_time_ = Timestamp::Now() + min_connect_timeout_;
+    return;
+  }
+  // If the main connection was lost and nobody has asked to reconnect yet,
+  // the new connection becomes the main one.
+  if (connected_subchannel_ == nullptr) {
+    connected_subchannel_ = std::move(connected_subchannel);
+    if (channelz_node_ != nullptr) {
+      channelz_node_->SetChildSocket(std::move(socket));
+    }
+    StartWatchingConnectionLocked(connected_subchannel_.get());
+    SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: new pooled connected subchannel at %p", this,
+            key_.ToString().c_str(), connected_subchannel.get());
+  }
+  if (channelz_node_ != nullptr && socket != nullptr) {
+    channelz_node_->AddPooledChildSocket(socket);
+  }
+  StartWatchingConnectionLocked(connected_subchannel.get());
+  pooled_connections_.push_back(
+      PooledConnection{std::move(connected_subchannel), std::move(socket)});
+}
+
+// Reporting IDLE when the main connection fails carries the transport's
+// keepalive info to the channel. A lost pooled connection leaves the
+// subchannel READY, so pass that info on without a state change.
+void Subchannel::PropagateKeepaliveThrottlingLocked(
+    const absl::Status& status) {
+  if (!status.GetPayload(kKeepaliveThrottlingKey).has_value()) return;
+  watcher_list_.NotifyLocked(state_, status);
+  health_watcher_map_.NotifyKeepaliveThrottlingLocked(status);
+}
+
+void Subchannel::NotifyDataProducersOfConnectionLossLocked(
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel) {
+  for (const auto& p : data_producer_map_) {
+    // The producer may be in the middle of being orphaned, in which case it
+    // is about to remove itself from the map.
+    RefCountedPtr<DataProducerInterface> data_producer =
+        p.second->RefIfNonZero();
+    if (data_producer == nullptr) continue;
+    work_serializer_.Schedule(
+        [data_producer = std::move(data_producer),
+         connected_subchannel]() {
+          data_producer->OnConnectionLost(connected_subchannel.get());
+        },
+        DEBUG_LOCATION);
+  }
+}
+
+void Subchannel::OnWarmupPingDoneLocked(
+    ConnectedSubchannel* connected_subchannel, grpc_error_handle error) {
+  // Ignore the ping or timer that finishes second, and any that finishes
+  // after the connection failed, in which case the connected subchannel
+  // state watcher has already reset connected_subchannel_ and reported IDLE.
+  if (shutdown_ || state_ != GRPC_CHANNEL_CONNECTING ||
+      connected_subchannel_.get() != connected_subchannel) {
+    return;
+  }
+  if (error.ok()) {
+    event_engine_->Cancel(warmup_timer_handle_);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+      gpr_log(GPR_INFO, "subchannel %p %s: warm-up ping acked on %p", this,
+              key_.ToString().c_str(), connected_subchannel);
+    }
+    SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+    return;
+  }
+  // The connection is not usable, so treat it like a failed connection
+  // attempt. Closing it also fails the pending ping, which releases the ref
+  // that the ping holds.
+  event_engine_->Cancel(warmup_timer_handle_);
+  connected_subchannel_->Disconnect(error);
+  connected_subchannel_.reset();
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(nullptr);
+  }
+  OnConnectAttemptFailedLocked(error);
 }
 
 }  // namespace grpc_core
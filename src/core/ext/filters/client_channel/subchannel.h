@@ -21,10 +21,12 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
@@ -77,6 +79,8 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
                   OrphanablePtr<ConnectivityStateWatcherInterface> watcher);
 
   void Ping(grpc_closure* on_initiate, grpc_closure* on_ack);
+  // Closes the connection.
+  void Disconnect(grpc_error_handle error);
 
   grpc_channel_stack* channel_stack() const { return channel_stack_; }
   const ChannelArgs& args() const { return args_; }
@@ -86,12 +90,23 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
 
   size_t GetInitialCallSizeEstimate() const;
 
+  // Number of calls picked onto this connection that have not been
+  // destroyed yet.
+  size_t active_calls() const {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+  void CallStarted() { active_calls_.fetch_add(1, std::memory_order_relaxed); }
+  void CallDestroyed() {
+    active_calls_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
  private:
   grpc_channel_stack* channel_stack_;
   ChannelArgs args_;
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
+  std::atomic<size_t> active_calls_{0};
 };
 
 // Implements the interface of RefCounted<>.
@@ -193,6 +208,13 @@ class Subchannel : public DualRefCounted<Subchannel> {
     // are expected to return the same string *instance*, not just the
     // same string contents.
     virtual UniqueTypeName type() const = 0;
+
+    // Called in the subchannel's work serializer when a connection is lost
+    // while the subchannel stays READY on another one, so that producers
+    // running calls on the lost connection can move them to
+    // connected_subchannel().
+    virtual void OnConnectionLost(
+        const ConnectedSubchannel* /*connected_subchannel*/) {}
   };
 
   // Creates a subchannel.
@@ -237,6 +259,14 @@ class Subchannel : public DualRefCounted<Subchannel> {
     return connected_subchannel_;
   }
 
+  // Returns the connection to use for a new call, or null if not
+  // connected. If the subchannel has several connections, that is the
+  // one with the fewest calls, and another one may be started if they
+  // are all busy. The call is counted against the connection right
+  // away; the caller must call CallDestroyed() on it when done.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelForCall()
+      ABSL_LOCKS_EXCLUDED(mu_);
+
   // Attempt to connect to the backend.  Has no effect if already connected.
   void RequestConnection() ABSL_LOCKS_EXCLUDED(mu_);
 
@@ -318,6 +348,15 @@ class Subchannel : public DualRefCounted<Subchannel> {
     void NotifyLocked(grpc_connectivity_state state, const absl::Status& status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
 
+    // Restarts health checks on the subchannel's new main connection.
+    void RestartHealthCheckingLocked()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
+
+    // Passes the keepalive info in \a status on to the watchers without
+    // changing their state.
+    void NotifyKeepaliveThrottlingLocked(const absl::Status& status)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
+
     grpc_connectivity_state CheckConnectivityStateLocked(
         Subchannel* subchannel, const std::string& health_check_service_name)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
@@ -332,6 +371,13 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   class ConnectedSubchannelStateWatcher;
 
+  // A connection other than connected_subchannel_, used when the subchannel
+  // is configured to open more than one.
+  struct PooledConnection {
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+    RefCountedPtr<channelz::SocketNode> socket;
+  };
+
   // Sets the subchannel's connectivity state to \a state.
   void SetConnectivityStateLocked(grpc_connectivity_state state,
                                   const absl::Status& status)
@@ -345,7 +391,37 @@ class Subchannel : public DualRefCounted<Subchannel> {
       ABSL_LOCKS_EXCLUDED(mu_);
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
-  bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool PublishTransportLocked(SubchannelConnector::Result* result)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Builds a connection from \a result. Returns null on failure.
+  RefCountedPtr<ConnectedSubchannel> BuildConnectedSubchannelLocked(
+      SubchannelConnector::Result* result,
+      RefCountedPtr<channelz::SocketNode>* socket)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void StartWatchingConnectionLocked(ConnectedSubchannel* connected_subchannel)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnConnectionFailedLocked(ConnectedSubchannel* connected_subchannel,
+                                grpc_connectivity_state new_state,
+                                const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for pooled connections.
+  void MaybeStartPooledConnectionLocked(size_t min_active_calls)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  static void OnPooledConnectingFinished(void* arg, grpc_error_handle error)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  void OnPooledConnectingFinishedLocked(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void PropagateKeepaliveThrottlingLocked(const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void NotifyDataProducersOfConnectionLossLocked(
+      RefCountedPtr<ConnectedSubchannel> connected_subchannel)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnConnectAttemptFailedLocked(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnWarmupPingDoneLocked(ConnectedSubchannel* connected_subchannel,
+                              grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -367,6 +443,8 @@ class Subchannel : public DualRefCounted<Subchannel> {
   OrphanablePtr<SubchannelConnector> connector_;
   SubchannelConnector::Result connecting_result_;
   grpc_closure on_connecting_finished_;
+  SubchannelConnector::Result pooled_connecting_result_;
+  grpc_closure on_pooled_connecting_finished_;
 
   // Protects the other members.
   Mutex mu_;
@@ -392,11 +470,29 @@ class Subchannel : public DualRefCounted<Subchannel> {
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
 
+  // Connection pool state. The pool size includes connected_subchannel_.
+  const size_t max_connections_;
+  const size_t calls_per_connection_;
+  std::vector<PooledConnection> pooled_connections_ ABSL_GUARDED_BY(mu_);
+  // Whether a pooled connection attempt is in progress.
+  bool connecting_pooled_connection_ ABSL_GUARDED_BY(mu_) = false;
+  // Set if a main connection attempt was needed while a pooled one was in
+  // progress. The connector handles one attempt at a time, so the pooled
+  // attempt's connection becomes the main one instead.
+  bool pooled_attempt_is_main_ ABSL_GUARDED_BY(mu_) = false;
+  // No pooled connection attempts before this time after one failed.
+  Timestamp next_pooled_connection_time_ ABSL_GUARDED_BY(mu_);
+
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
   Timestamp next_attempt_time_ ABSL_GUARDED_BY(mu_);
   grpc_event_engine::experimental::EventEngine::TaskHandle retry_timer_handle_
       ABSL_GUARDED_BY(mu_);
+  // Deadline of the current connection attempt, which also bounds the wait
+  // for the warm-up ping.
+  Timestamp connect_deadline_ ABSL_GUARDED_BY(mu_);
+  grpc_event_engine::experimental::EventEngine::TaskHandle warmup_timer_handle_
+      ABSL_GUARDED_BY(mu_);
 
   // Keepalive time period (-1 for unset)
   int keepalive_time_ ABSL_GUARDED_BY(mu_) = -1;
@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <deque>
 #include <initializer_list>
 #include <map>
 #include <memory>
@@ -54,6 +55,8 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/gprpp/debug_location.h"
@@ -158,6 +161,9 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
       void Start(grpc_endpoint* endpoint, const ChannelArgs& args);
 
+      // The handshake deadline, which starts running at accept time.
+      Timestamp deadline() const { return deadline_; }
+
       // Needed to be able to grab an external ref in
       // ActiveConnection::Start()
       using InternallyRefCounted<HandshakingState>::Ref;
@@ -189,7 +195,10 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
     void SendGoAway();
 
-    void Start(RefCountedPtr<Chttp2ServerListener> listener,
+    // Starts the handshake. Returns false, having destroyed the endpoint, if
+    // the connection was shut down before the handshake could start, or if
+    // it waited for a handshake slot past its handshake deadline.
+    bool Start(RefCountedPtr<Chttp2ServerListener> listener,
                grpc_endpoint* endpoint, const ChannelArgs& args);
 
     // Needed to be able to grab an external ref in
@@ -227,6 +236,11 @@ class Chttp2ServerListener : public Server::ListenerInterface {
                        grpc_pollset* accepting_pollset,
                        grpc_tcp_server_acceptor* acceptor);
 
+  // Called when a connection admitted under
+  // GRPC_ARG_SERVER_MAX_CONCURRENT_HANDSHAKES is done handshaking, whatever
+  // the outcome. Starts the handshake of the next queued connection, if any.
+  void OnHandshakeSlotReleased();
+
   static void TcpServerShutdownComplete(void* arg, grpc_error_handle error);
 
   static void DestroyListener(Server* /*server*/, void* arg,
@@ -278,6 +292,17 @@ class Chttp2ServerListener : public Server::ListenerInterface {
   bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
   std::map<ActiveConnection*, OrphanablePtr<ActiveConnection>> connections_
       ABSL_GUARDED_BY(mu_);
+  // A connection that has been accepted but is waiting for a handshake slot.
+  struct PendingHandshake {
+    RefCountedPtr<ActiveConnection> connection;
+    RefCountedPtr<Chttp2ServerListener> listener;
+    grpc_endpoint* endpoint = nullptr;
+    ChannelArgs args;
+  };
+  // Maximum number of concurrent handshakes, 0 if unlimited.
+  int const max_concurrent_handshakes_;
+  int num_handshakes_in_progress_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<PendingHandshake> pending_handshakes_ ABSL_GUARDED_BY(mu_);
   grpc_closure tcp_server_shutdown_complete_ ABSL_GUARDED_BY(mu_);
   grpc_closure* on_destroy_done_ ABSL_GUARDED_BY(mu_) = nullptr;
   RefCountedPtr<channelz::ListenSocketNode> channelz_listen_socket_;
@@ -552,6 +577,7 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
       self->connection_->listener_->connections_.erase(it);
     }
   }
+  self->connection_->listener_->OnHandshakeSlotReleased();
   self->Unref();
 }
 
@@ -617,19 +643,49 @@ void Chttp2ServerListener::ActiveConnection::SendGoAway() {
   }
 }
 
-void Chttp2ServerListener::ActiveConnection::Start(
+bool Chttp2ServerListener::ActiveConnection::Start(
     RefCountedPtr<Chttp2ServerListener> listener, grpc_endpoint* endpoint,
     const ChannelArgs& args) {
   RefCountedPtr<HandshakingState> handshaking_state_ref;
   listener_ = std::move(listener);
+  bool deadline_exceeded = false;
   {
     MutexLock lock(&mu_);
-    if (shutdown_) return;
     // Hold a ref to HandshakingState to allow starting the handshake outside
     // the critical region.
-    handshaking_state_ref = handshaking_state_->Ref();
+    if (!shutdown_) {
+      // The deadline started at accept, so a connection that sat in the
+      // handshake queue for too long is dropped without handshaking.
+      if (handshaking_state_->deadline() <= Timestamp::Now()) {
+        deadline_exceeded = true;
+      } else {
+        handshaking_state_ref = handshaking_state_->Ref();
+      }
+    }
+  }
+  if (deadline_exceeded) {
+    OrphanablePtr<ActiveConnection> connection;
+    {
+      MutexLock listener_lock(&listener_->mu_);
+      MutexLock lock(&mu_);
+      if (!shutdown_) {
+        auto it = listener_->connections_.find(this);
+        if (it != listener_->connections_.end()) {
+          connection = std::move(it->second);
+          listener_->connections_.erase(it);
+        }
+        shutdown_ = true;
+      }
+    }
+  }
+  if (handshaking_state_ref == nullptr) {
+    // The handshake never started, so nothing else owns the endpoint.
+    grpc_endpoint_shutdown(endpoint, absl::OkStatus());
+    grpc_endpoint_destroy(endpoint);
+    return false;
   }
   handshaking_state_ref->Start(endpoint, args);
+  return true;
 }
 
 void Chttp2ServerListener::ActiveConnection::OnClose(
@@ -759,6 +815,9 @@ Chttp2ServerListener::Chttp2ServerListener(
     : server_(server),
       args_modifier_(args_modifier),
       args_(args),
+      max_concurrent_handshakes_(std::max(
+          0, args.GetInt(GRPC_ARG_SERVER_MAX_CONCURRENT_HANDSHAKES)
+                 .value_or(0))),
       memory_quota_(args.GetObject<ResourceQuota>()->memory_quota()) {
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
@@ -866,12 +925,50 @@ void Chttp2ServerListener::OnAccept(void* arg, grpc_endpoint* tcp,
       // Chttp2ServerListener is grpc_tcp_server_ref().)
       listener_ref = self->Ref();
       self->connections_.emplace(connection.get(), std::move(connection));
+      if (self->max_concurrent_handshakes_ > 0) {
+        // During a reconnect storm, starting every handshake right away
+        // starves established connections of CPU, so queue the handshake
+        // instead if too many are already in progress.
+        if (self->num_handshakes_in_progress_ >=
+            self->max_concurrent_handshakes_) {
+          self->pending_handshakes_.push_back(
+              {std::move(connection_ref), std::move(listener_ref), tcp, args});
+          global_stats().IncrementServerHandshakesQueued();
+          global_stats().IncrementServerHandshakeQueueDepth(
+              static_cast<int>(self->pending_handshakes_.size()));
+          return;
+        }
+        ++self->num_handshakes_in_progress_;
+      }
     }
   }
   if (connection != nullptr) {
     endpoint_cleanup(absl::OkStatus());
-  } else {
-    connection_ref->Start(std::move(listener_ref), tcp, args);
+  } else if (!connection_ref->Start(std::move(listener_ref), tcp, args)) {
+    self->OnHandshakeSlotReleased();
+  }
+}
+
+void Chttp2ServerListener::OnHandshakeSlotReleased() {
+  if (max_concurrent_handshakes_ == 0) return;
+  // Hand the slot over to the oldest queued connection. A connection that was
+  // shut down while queued gives the slot straight back, so keep going until
+  // one actually starts handshaking.
+  while (true) {
+    PendingHandshake next;
+    {
+      MutexLock lock(&mu_);
+      if (pending_handshakes_.empty()) {
+        --num_handshakes_in_progress_;
+        return;
+      }
+      next = std::move(pending_handshakes_.front());
+      pending_handshakes_.pop_front();
+    }
+    if (next.connection->Start(std::move(next.listener), next.endpoint,
+                               next.args)) {
+      return;
+    }
   }
 }
 
@@ -891,6 +988,7 @@ void Chttp2ServerListener::Orphan() {
     server_->config_fetcher()->CancelWatch(config_fetcher_watcher_);
   }
   std::map<ActiveConnection*, OrphanablePtr<ActiveConnection>> connections;
+  std::deque<PendingHandshake> pending_handshakes;
   grpc_tcp_server* tcp_server;
   {
     MutexLock lock(&mu_);
@@ -898,6 +996,8 @@ void Chttp2ServerListener::Orphan() {
     is_serving_ = false;
     // Orphan the connections so that they can start cleaning up.
     connections = std::move(connections_);
+    // Connections still waiting for a handshake slot will never get one.
+    pending_handshakes = std::move(pending_handshakes_);
     // If the listener is currently set to be serving but has not been started
     // yet, it means that `grpc_tcp_server_start` is in progress. Wait for the
     // operation to finish to avoid causing races.
@@ -906,6 +1006,12 @@ void Chttp2ServerListener::Orphan() {
     }
     tcp_server = tcp_server_;
   }
+  for (PendingHandshake& pending : pending_handshakes) {
+    grpc_endpoint_shutdown(pending.endpoint,
+                           GRPC_ERROR_CREATE("Listener stopped serving."));
+    grpc_endpoint_destroy(pending.endpoint);
+  }
+  pending_handshakes.clear();
   grpc_tcp_server_shutdown_listeners(tcp_server);
   grpc_tcp_server_unref(tcp_server);
 }
@@ -570,6 +570,21 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   read_channel_args(this, channel_args, is_client);
 
+  if (grpc_core::IsTcpRpcLatencyBreakdownEnabled()) {
+    // Have the TCP endpoint hand the timestamps of traced writes back to the
+    // ContextList, which reports their latency breakdown. An application that
+    // set its own callback is expected to pass the timestamps on to
+    // ContextList::Execute itself, so that callback is left in place.
+    static const bool timestamps_callback_registered = []() {
+      if (!grpc_core::grpc_tcp_write_timestamps_callback_is_set()) {
+        grpc_core::grpc_tcp_set_write_timestamps_callback(
+            grpc_core::ContextList::Execute);
+      }
+      return true;
+    }();
+    (void)timestamps_callback_registered;
+  }
+
   // No pings allowed before receiving a header or data frame.
   ping_state.pings_before_data_required = 0;
   ping_state.last_ping_sent_time = grpc_core::Timestamp::InfPast();
@@ -766,6 +781,12 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
     }
   }
 
+  if (write_latency_tracer != nullptr) {
+    // Timestamps of writes still in flight must not reach the CallTracer,
+    // which is destroyed with the call.
+    write_latency_tracer->Detach();
+  }
+
   GPR_ASSERT((write_closed && read_closed) || id == 0);
   if (id != 0) {
     GPR_ASSERT(grpc_chttp2_stream_map_find(&t->stream_map, id) == nullptr);
@@ -1294,6 +1315,18 @@ static void perform_stream_op_locked(void* stream_op,
 
   s->context = op->payload->context;
   s->traced = op->is_traced;
+  if (grpc_core::IsTcpRpcLatencyBreakdownEnabled() &&
+      s->write_latency_tracer == nullptr && s->context != nullptr) {
+    auto* call_tracer = static_cast<grpc_core::CallTracer*>(
+        static_cast<grpc_call_context_element*>(
+            s->context)[GRPC_CONTEXT_CALL_TRACER]
+            .value);
+    if (call_tracer != nullptr) {
+      s->write_latency_tracer =
+          grpc_core::MakeRefCounted<grpc_core::WriteLatencyTracer>(
+              call_tracer);
+    }
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)) {
     gpr_log(GPR_INFO,
             "perform_stream_op_locked[s=%p; op=%p]: %s; on_complete = %p", s,
@@ -22,24 +22,104 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 
 namespace {
 void (*write_timestamps_callback_g)(void*, grpc_core::Timestamps*,
                                     grpc_error_handle error) = nullptr;
 void* (*get_copied_context_fn_g)(void*) = nullptr;
+
+// Returns the number of microseconds from \a start to \a end, or nullopt if
+// either timestamp was not collected (the kernel does not report every
+// timestamp type for every write).
+absl::optional<int64_t> MicrosBetween(gpr_timespec start, gpr_timespec end) {
+  const gpr_timespec not_collected = gpr_inf_past(GPR_CLOCK_REALTIME);
+  if (gpr_time_cmp(start, not_collected) == 0 ||
+      gpr_time_cmp(end, not_collected) == 0 || gpr_time_cmp(end, start) < 0) {
+    return absl::nullopt;
+  }
+  gpr_timespec diff = gpr_time_sub(end, start);
+  return diff.tv_sec * GPR_US_PER_SEC + diff.tv_nsec / GPR_NS_PER_US;
+}
+
+int ClampToInt(int64_t value) {
+  return static_cast<int>(
+      std::min<int64_t>(value, std::numeric_limits<int>::max()));
+}
+
+// Splits the time from \a append_time until the peer acked the write into the
+// time spent queued in gRPC, in the kernel's TCP stack, in its packet
+// scheduler and until the peer acked it, and reports each part that could be
+// measured.
+void RecordWriteLatency(const grpc_core::Timestamps& ts,
+                        gpr_timespec append_time,
+                        grpc_core::WriteLatencyTracer* latency_tracer) {
+  auto queued = MicrosBetween(append_time, ts.sendmsg_time.time);
+  auto kernel = MicrosBetween(ts.sendmsg_time.time, ts.scheduled_time.time);
+  auto scheduler = MicrosBetween(ts.scheduled_time.time, ts.sent_time.time);
+  auto ack = MicrosBetween(ts.sent_time.time, ts.acked_time.time);
+  auto& stats = grpc_core::global_stats();
+  if (queued.has_value()) {
+    stats.IncrementHttp2WriteQueuedUs(ClampToInt(*queued));
+  }
+  if (kernel.has_value()) stats.IncrementTcpWriteKernelUs(ClampToInt(*kernel));
+  if (scheduler.has_value()) {
+    stats.IncrementTcpWriteSchedulerUs(ClampToInt(*scheduler));
+  }
+  if (ack.has_value()) stats.IncrementTcpWriteAckUs(ClampToInt(*ack));
+  if (latency_tracer == nullptr) return;
+  std::string annotation =
+      absl::StrCat("TCP write acked: byte_offset=", ts.byte_offset);
+  auto append = [&annotation](absl::string_view name,
+                              absl::optional<int64_t> micros) {
+    if (micros.has_value()) {
+      absl::StrAppend(&annotation, " ", name, "_us=", *micros);
+    }
+  };
+  append("queued", queued);
+  append("kernel", kernel);
+  append("scheduler", scheduler);
+  append("ack", ack);
+  latency_tracer->RecordAnnotation(annotation);
+}
 }  // namespace
 
 namespace grpc_core {
+
+void WriteLatencyTracer::RecordAnnotation(absl::string_view annotation) {
+  MutexLock lock(&mu_);
+  if (call_tracer_ != nullptr) call_tracer_->RecordAnnotation(annotation);
+}
+
+void WriteLatencyTracer::Detach() {
+  MutexLock lock(&mu_);
+  call_tracer_ = nullptr;
+}
+
 void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
-  if (get_copied_context_fn_g == nullptr ||
-      write_timestamps_callback_g == nullptr) {
+  const bool has_callback = get_copied_context_fn_g != nullptr &&
+                            write_timestamps_callback_g != nullptr;
+  if (!has_callback && s->write_latency_tracer == nullptr) {
     return;
   }
   // Create a new element in the list and add it at the front
   ContextList* elem = new ContextList();
-  elem->trace_context_ = get_copied_context_fn_g(s->context);
+  if (has_callback) {
+    elem->trace_context_ = get_copied_context_fn_g(s->context);
+  }
   elem->byte_offset_ = s->byte_counter;
+  elem->append_time_ = gpr_now(GPR_CLOCK_REALTIME);
+  elem->latency_tracer_ = s->write_latency_tracer;
   elem->next_ = *head;
   *head = elem;
 }
@@ -48,10 +128,14 @@ void ContextList::Execute(void* arg, Timestamps* ts, grpc_error_handle error) {
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
-      if (ts) {
-        ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
+    if (ts != nullptr) {
+      ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
+      if (error.ok()) {
+        RecordWriteLatency(*ts, head->append_time_,
+                           head->latency_tracer_.get());
       }
+    }
+    if (write_timestamps_callback_g) {
       write_timestamps_callback_g(head->trace_context_, ts, error);
     }
     to_be_freed = head;
@@ -23,11 +23,42 @@
 
 #include <stddef.h>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/time.h>
+
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/channel/call_tracer.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/error.h"
 
 namespace grpc_core {
+
+/// Forwards the TCP write latency breakdown of a stream to its CallTracer.
+/// Timestamps for a write may arrive after the stream is gone, so this is
+/// shared between the stream and its ContextList entries, and the stream
+/// detaches it before the CallTracer is destroyed.
+class WriteLatencyTracer : public RefCounted<WriteLatencyTracer> {
+ public:
+  explicit WriteLatencyTracer(CallTracer* call_tracer)
+      : call_tracer_(call_tracer) {}
+
+  // Records \a annotation on the CallTracer, unless already detached.
+  void RecordAnnotation(absl::string_view annotation);
+
+  // Called when the stream is destroyed. No annotation is recorded once this
+  // returns.
+  void Detach();
+
+ private:
+  Mutex mu_;
+  CallTracer* call_tracer_ ABSL_GUARDED_BY(mu_);
+};
+
 /// A list of RPC Contexts
 class ContextList {
  public:
@@ -37,13 +68,19 @@ class ContextList {
 
   // Executes a function \a fn with each context in the list and \a ts. It also
   // frees up the entire list after this operation. It is intended as a callback
-  // and hence does not take a ref on \a error
+  // and hence does not take a ref on \a error. If the write was acked, the
+  // latency breakdown of each context is also recorded to the stats
+  // histograms and to the stream's WriteLatencyTracer, if any.
   static void Execute(void* arg, Timestamps* ts, grpc_error_handle error);
 
  private:
   void* trace_context_ = nullptr;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
+  // When the stream's bytes were framed, i.e. when they started waiting for
+  // sendmsg.
+  gpr_timespec append_time_;
+  RefCountedPtr<WriteLatencyTracer> latency_tracer_;
 };
 
 void grpc_http2_set_write_timestamps_callback(
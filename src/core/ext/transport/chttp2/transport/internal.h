@@ -79,6 +79,7 @@
 
 namespace grpc_core {
 class ContextList;
+class WriteLatencyTracer;
 }
 
 // streams are kept in various linked lists depending on what things need to
@@ -601,6 +602,9 @@ struct grpc_chttp2_stream {
 
   /// Whether the bytes needs to be traced using Fathom
   bool traced = false;
+  /// Set if the TCP write latency breakdown of this stream is reported to its
+  /// CallTracer
+  grpc_core::RefCountedPtr<grpc_core::WriteLatencyTracer> write_latency_tracer;
   /// Byte counter for number of bytes written
   size_t byte_counter = 0;
 
@@ -649,7 +649,8 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     if (t->outbuf.length > orig_len) {
       // Add this stream to the list of the contexts to be traced at TCP
       s->byte_counter += t->outbuf.length - orig_len;
-      if (s->traced && grpc_endpoint_can_track_err(t->ep)) {
+      if ((s->traced || s->write_latency_tracer != nullptr) &&
+          grpc_endpoint_can_track_err(t->ep)) {
         grpc_core::ContextList::Append(&t->cl, s);
       }
     }
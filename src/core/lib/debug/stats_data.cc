@@ -69,15 +69,19 @@ Histogram_80_10 operator-(const Histogram_80_10& left,
 }
 const absl::string_view
     GlobalStats::counter_name[static_cast<int>(Counter::COUNT)] = {
-        "client_calls_created",    "server_calls_created",
-        "client_channels_created", "client_subchannels_created",
-        "server_channels_created", "insecure_connections_created",
-        "syscall_write",           "syscall_read",
-        "tcp_read_alloc_8k",       "tcp_read_alloc_64k",
-        "http2_settings_writes",   "http2_pings_sent",
-        "http2_writes_begun",      "http2_transport_stalls",
-        "http2_stream_stalls",     "cq_pluck_creates",
-        "cq_next_creates",         "cq_callback_creates",
+        "client_calls_created",          "server_calls_created",
+        "client_channels_created",       "client_subchannels_created",
+        "server_channels_created",       "insecure_connections_created",
+        "syscall_write",                 "syscall_read",
+        "tcp_read_alloc_8k",             "tcp_read_alloc_64k",
+        "http2_settings_writes",         "http2_pings_sent",
+        "http2_writes_begun",            "http2_transport_stalls",
+        "http2_stream_stalls",           "cq_pluck_creates",
+        "cq_next_creates",               "cq_callback_creates",
+        "syscall_epoll_ctl",             "syscall_epoll_ctl_elided",
+        "server_handshakes_queued",      "client_channel_backup_polls",
+        "sync_server_requests_rejected", "rls_lock_free_picks",
+        "rls_locked_picks",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -105,12 +109,28 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of epoll_ctl syscalls made by the event engine epoll1 poller",
+    "Number of epoll_ctl syscalls avoided because a handle was orphaned before "
+    "its deferred registration reached the epoll set",
+    "Number of accepted connections whose handshake was queued because the "
+    "listener reached its concurrent handshake limit",
+    "Number of times the client channel backup poller woke up to poll idle "
+    "channels",
+    "Number of sync server requests rejected because the work queue was full",
+    "Number of RLS picks served from fresh published cache data without taking "
+    "the LB policy lock",
+    "Number of RLS picks that went through the locked path, because the cache "
+    "had no fresh data for the key",
 };
 const absl::string_view GlobalStats::histogram_name[static_cast<int>(
     Histogram::COUNT)] = {
-    "call_initial_size",       "tcp_write_size",      "tcp_write_iov_size",
-    "tcp_read_size",           "tcp_read_offer",      "tcp_read_offer_iov_size",
-    "http2_send_message_size", "http2_metadata_size",
+    "call_initial_size",            "tcp_write_size",
+    "tcp_write_iov_size",           "tcp_read_size",
+    "tcp_read_offer",               "tcp_read_offer_iov_size",
+    "http2_send_message_size",      "http2_metadata_size",
+    "server_handshake_queue_depth", "http2_write_queued_us",
+    "tcp_write_kernel_us",          "tcp_write_scheduler_us",
+    "tcp_write_ack_us",             "sync_server_queue_delay_us",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -122,6 +142,18 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
+    "Number of accepted connections waiting for a handshake slot, sampled each "
+    "time one is queued",
+    "Microseconds between HTTP2 framing bytes of a traced stream and passing "
+    "them to sendmsg",
+    "Microseconds between sendmsg of a traced write and the kernel scheduling "
+    "it for transmission",
+    "Microseconds a traced write spent in the kernel packet scheduler before "
+    "being handed to the network device",
+    "Microseconds between a traced write being handed to the network device "
+    "and the peer acknowledging it",
+    "Microseconds a sync server request spent in the work queue before a "
+    "worker thread picked it up",
 };
 namespace {
 const int kStatsTable0[27] = {0,    1,     2,     4,     7,     11,   17,
@@ -220,7 +252,14 @@ GlobalStats::GlobalStats()
       http2_stream_stalls{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
-      cq_callback_creates{0} {}
+      cq_callback_creates{0},
+      syscall_epoll_ctl{0},
+      syscall_epoll_ctl_elided{0},
+      server_handshakes_queued{0},
+      client_channel_backup_polls{0},
+      sync_server_requests_rejected{0},
+      rls_lock_free_picks{0},
+      rls_locked_picks{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -249,6 +288,24 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2MetadataSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
                            http2_metadata_size.buckets()};
+    case Histogram::kServerHandshakeQueueDepth:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
+                           server_handshake_queue_depth.buckets()};
+    case Histogram::kHttp2WriteQueuedUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           http2_write_queued_us.buckets()};
+    case Histogram::kTcpWriteKernelUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           tcp_write_kernel_us.buckets()};
+    case Histogram::kTcpWriteSchedulerUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           tcp_write_scheduler_us.buckets()};
+    case Histogram::kTcpWriteAckUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           tcp_write_ack_us.buckets()};
+    case Histogram::kSyncServerQueueDelayUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           sync_server_queue_delay_us.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -288,6 +345,20 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->syscall_epoll_ctl +=
+        data.syscall_epoll_ctl.load(std::memory_order_relaxed);
+    result->syscall_epoll_ctl_elided +=
+        data.syscall_epoll_ctl_elided.load(std::memory_order_relaxed);
+    result->server_handshakes_queued +=
+        data.server_handshakes_queued.load(std::memory_order_relaxed);
+    result->client_channel_backup_polls +=
+        data.client_channel_backup_polls.load(std::memory_order_relaxed);
+    result->sync_server_requests_rejected +=
+        data.sync_server_requests_rejected.load(std::memory_order_relaxed);
+    result->rls_lock_free_picks +=
+        data.rls_lock_free_picks.load(std::memory_order_relaxed);
+    result->rls_locked_picks +=
+        data.rls_locked_picks.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -296,6 +367,14 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
+    data.server_handshake_queue_depth.Collect(
+        &result->server_handshake_queue_depth);
+    data.http2_write_queued_us.Collect(&result->http2_write_queued_us);
+    data.tcp_write_kernel_us.Collect(&result->tcp_write_kernel_us);
+    data.tcp_write_scheduler_us.Collect(&result->tcp_write_scheduler_us);
+    data.tcp_write_ack_us.Collect(&result->tcp_write_ack_us);
+    data.sync_server_queue_delay_us.Collect(
+        &result->sync_server_queue_delay_us);
   }
   return result;
 }
@@ -327,6 +406,17 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->syscall_epoll_ctl = syscall_epoll_ctl - other.syscall_epoll_ctl;
+  result->syscall_epoll_ctl_elided =
+      syscall_epoll_ctl_elided - other.syscall_epoll_ctl_elided;
+  result->server_handshakes_queued =
+      server_handshakes_queued - other.server_handshakes_queued;
+  result->client_channel_backup_polls =
+      client_channel_backup_polls - other.client_channel_backup_polls;
+  result->sync_server_requests_rejected =
+      sync_server_requests_rejected - other.sync_server_requests_rejected;
+  result->rls_lock_free_picks = rls_lock_free_picks - other.rls_lock_free_picks;
+  result->rls_locked_picks = rls_locked_picks - other.rls_locked_picks;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -337,6 +427,16 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
+  result->server_handshake_queue_depth =
+      server_handshake_queue_depth - other.server_handshake_queue_depth;
+  result->http2_write_queued_us =
+      http2_write_queued_us - other.http2_write_queued_us;
+  result->tcp_write_kernel_us = tcp_write_kernel_us - other.tcp_write_kernel_us;
+  result->tcp_write_scheduler_us =
+      tcp_write_scheduler_us - other.tcp_write_scheduler_us;
+  result->tcp_write_ack_us = tcp_write_ack_us - other.tcp_write_ack_us;
+  result->sync_server_queue_delay_us =
+      sync_server_queue_delay_us - other.sync_server_queue_delay_us;
   return result;
 }
 }  // namespace grpc_core
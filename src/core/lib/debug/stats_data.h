@@ -119,6 +119,13 @@ struct GlobalStats {
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kSyscallEpollCtl,
+    kSyscallEpollCtlElided,
+    kServerHandshakesQueued,
+    kClientChannelBackupPolls,
+    kSyncServerRequestsRejected,
+    kRlsLockFreePicks,
+    kRlsLockedPicks,
     COUNT
   };
   enum class Histogram {
@@ -130,6 +137,12 @@ struct GlobalStats {
     kTcpReadOfferIovSize,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
+    kServerHandshakeQueueDepth,
+    kHttp2WriteQueuedUs,
+    kTcpWriteKernelUs,
+    kTcpWriteSchedulerUs,
+    kTcpWriteAckUs,
+    kSyncServerQueueDelayUs,
     COUNT
   };
   GlobalStats();
@@ -159,6 +172,13 @@ struct GlobalStats {
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t syscall_epoll_ctl;
+      uint64_t syscall_epoll_ctl_elided;
+      uint64_t server_handshakes_queued;
+      uint64_t client_channel_backup_polls;
+      uint64_t sync_server_requests_rejected;
+      uint64_t rls_lock_free_picks;
+      uint64_t rls_locked_picks;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -170,6 +190,12 @@ struct GlobalStats {
   Histogram_80_10 tcp_read_offer_iov_size;
   Histogram_16777216_20 http2_send_message_size;
   Histogram_65536_26 http2_metadata_size;
+  Histogram_65536_26 server_handshake_queue_depth;
+  Histogram_16777216_20 http2_write_queued_us;
+  Histogram_16777216_20 tcp_write_kernel_us;
+  Histogram_16777216_20 tcp_write_scheduler_us;
+  Histogram_16777216_20 tcp_write_ack_us;
+  Histogram_16777216_20 sync_server_queue_delay_us;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -240,6 +266,32 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementSyscallEpollCtl() {
+    data_.this_cpu().syscall_epoll_ctl.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementSyscallEpollCtlElided() {
+    data_.this_cpu().syscall_epoll_ctl_elided.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementServerHandshakesQueued() {
+    data_.this_cpu().server_handshakes_queued.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementClientChannelBackupPolls() {
+    data_.this_cpu().client_channel_backup_polls.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSyncServerRequestsRejected() {
+    data_.this_cpu().sync_server_requests_rejected.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementRlsLockFreePicks() {
+    data_.this_cpu().rls_lock_free_picks.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementRlsLockedPicks() {
+    data_.this_cpu().rls_locked_picks.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -264,6 +316,24 @@ class GlobalStatsCollector {
   void IncrementHttp2MetadataSize(int value) {
     data_.this_cpu().http2_metadata_size.Increment(value);
   }
+  void IncrementServerHandshakeQueueDepth(int value) {
+    data_.this_cpu().server_handshake_queue_depth.Increment(value);
+  }
+  void IncrementHttp2WriteQueuedUs(int value) {
+    data_.this_cpu().http2_write_queued_us.Increment(value);
+  }
+  void IncrementTcpWriteKernelUs(int value) {
+    data_.this_cpu().tcp_write_kernel_us.Increment(value);
+  }
+  void IncrementTcpWriteSchedulerUs(int value) {
+    data_.this_cpu().tcp_write_scheduler_us.Increment(value);
+  }
+  void IncrementTcpWriteAckUs(int value) {
+    data_.this_cpu().tcp_write_ack_us.Increment(value);
+  }
+  void IncrementSyncServerQueueDelayUs(int value) {
+    data_.this_cpu().sync_server_queue_delay_us.Increment(value);
+  }
 
  private:
   struct Data {
@@ -285,6 +355,13 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> syscall_epoll_ctl{0};
+    std::atomic<uint64_t> syscall_epoll_ctl_elided{0};
+    std::atomic<uint64_t> server_handshakes_queued{0};
+    std::atomic<uint64_t> client_channel_backup_polls{0};
+    std::atomic<uint64_t> sync_server_requests_rejected{0};
+    std::atomic<uint64_t> rls_lock_free_picks{0};
+    std::atomic<uint64_t> rls_locked_picks{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
@@ -293,6 +370,12 @@ class GlobalStatsCollector {
     HistogramCollector_80_10 tcp_read_offer_iov_size;
     HistogramCollector_16777216_20 http2_send_message_size;
     HistogramCollector_65536_26 http2_metadata_size;
+    HistogramCollector_65536_26 server_handshake_queue_depth;
+    HistogramCollector_16777216_20 http2_write_queued_us;
+    HistogramCollector_16777216_20 tcp_write_kernel_us;
+    HistogramCollector_16777216_20 tcp_write_scheduler_us;
+    HistogramCollector_16777216_20 tcp_write_ack_us;
+    HistogramCollector_16777216_20 sync_server_queue_delay_us;
   };
   PerCpu<Data> data_;
 };
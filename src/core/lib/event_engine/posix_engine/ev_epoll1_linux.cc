@@ -32,6 +32,7 @@
 
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/iomgr/port.h"
 
@@ -44,6 +45,8 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -61,8 +64,9 @@ namespace experimental {
 
 class Epoll1EventHandle : public EventHandle {
  public:
-  Epoll1EventHandle(int fd, Epoll1Poller* poller)
+  Epoll1EventHandle(int fd, bool track_err, Epoll1Poller* poller)
       : fd_(fd),
+        track_err_(track_err),
         list_(this),
         poller_(poller),
         read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
@@ -76,8 +80,9 @@ class Epoll1EventHandle : public EventHandle {
     pending_write_.store(false, std::memory_order_relaxed);
     pending_error_.store(false, std::memory_order_relaxed);
   }
-  void ReInit(int fd) {
+  void ReInit(int fd, bool track_err) {
     fd_ = fd;
+    track_err_ = track_err;
     read_closure_->InitEvent();
     write_closure_->InitEvent();
     error_closure_->InitEvent();
@@ -111,6 +116,7 @@ class Epoll1EventHandle : public EventHandle {
     return pending_read || pending_write || pending_error;
   }
   int WrappedFd() override { return fd_; }
+  bool TrackErr() const { return track_err_; }
   void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
                     absl::string_view reason) override;
   void ShutdownHandle(absl::Status why) override;
@@ -139,6 +145,9 @@ class Epoll1EventHandle : public EventHandle {
   LockfreeEvent* WriteClosure() { return write_closure_.get(); }
   LockfreeEvent* ErrorClosure() { return error_closure_.get(); }
   Epoll1Poller::HandlesList& ForkFdListPos() { return list_; }
+  // Only accessed with poller_->mu_ held.
+  bool& RegistrationPending() { return registration_pending_; }
+  size_t& PendingRegistrationIndex() { return pending_registration_index_; }
   ~Epoll1EventHandle() override = default;
 
  private:
@@ -147,6 +156,13 @@ class Epoll1EventHandle : public EventHandle {
   // required.
   grpc_core::Mutex mu_;
   int fd_;
+  bool track_err_;
+  // True while the EPOLL_CTL_ADD for fd_ is deferred to the next poll cycle.
+  // See Epoll1Poller::CreateHandle.
+  bool registration_pending_ = false;
+  // Position of this handle in poller_->pending_registrations_ while
+  // registration_pending_ is true, so that it can be dropped in O(1).
+  size_t pending_registration_index_ = 0;
   // See Epoll1Poller::SetPendingActions for explanation on why pending_<***>_
   // need to be atomic.
   std::atomic<bool> pending_read_{false};
@@ -286,23 +302,32 @@ void Epoll1EventHandle::OrphanHandle(PosixEngineClosure* on_done,
                                      int* release_fd,
                                      absl::string_view reason) {
   bool is_release_fd = (release_fd != nullptr);
+  // A handle orphaned before its deferred registration was flushed was never
+  // added to the epoll set, so there is nothing to remove from it either.
+  bool is_registered = !poller_->CancelPendingRegistration(this);
+  if (!is_registered) {
+    grpc_core::global_stats().IncrementSyscallEpollCtlElided();
+  }
   bool was_shutdown = false;
   if (!read_closure_->IsShutdown()) {
     was_shutdown = true;
     HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason),
-                           is_release_fd);
+                           is_release_fd && is_registered);
   }
 
   // If release_fd is not NULL, we should be relinquishing control of the file
   // descriptor fd->fd (but we still own the grpc_fd structure).
   if (is_release_fd) {
-    if (!was_shutdown) {
+    if (!was_shutdown && is_registered) {
       epoll_event phony_event;
+      grpc_core::global_stats().IncrementSyscallEpollCtl();
       if (epoll_ctl(poller_->g_epoll_set_.epfd, EPOLL_CTL_DEL, fd_,
                     &phony_event) != 0) {
         gpr_log(GPR_ERROR, "OrphanHandle: epoll_ctl failed: %s",
                 grpc_core::StrError(errno).c_str());
       }
+    } else if (!is_registered) {
+      grpc_core::global_stats().IncrementSyscallEpollCtlElided();
     }
     *release_fd = fd_;
   } else {
@@ -342,6 +367,7 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
   if (read_closure_->SetShutdown(why)) {
     if (releasing_fd) {
       epoll_event phony_event;
+      grpc_core::global_stats().IncrementSyscallEpollCtl();
       if (epoll_ctl(poller_->g_epoll_set_.epfd, EPOLL_CTL_DEL, fd_,
                     &phony_event) != 0) {
         gpr_log(GPR_ERROR, "HandleShutdownInternal: epoll_ctl failed: %s",
@@ -354,7 +380,11 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      batch_registrations_(
+          grpc_core::IsEventEngineBatchedEpollRegistrationEnabled()),
+      closed_(false) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   GPR_ASSERT(wakeup_fd_ != nullptr);
@@ -384,6 +414,10 @@ void Epoll1Poller::Close() {
     g_epoll_set_.epfd = -1;
   }
 
+  for (Epoll1EventHandle* handle : pending_registrations_) {
+    handle->RegistrationPending() = false;
+  }
+  pending_registrations_.clear();
   while (!free_epoll1_handles_list_.empty()) {
     Epoll1EventHandle* handle =
         reinterpret_cast<Epoll1EventHandle*>(free_epoll1_handles_list_.front());
@@ -398,18 +432,38 @@ Epoll1Poller::~Epoll1Poller() { Close(); }
 EventHandle* Epoll1Poller::CreateHandle(int fd, absl::string_view /*name*/,
                                         bool track_err) {
   Epoll1EventHandle* new_handle = nullptr;
+  bool registration_deferred = false;
   {
     grpc_core::MutexLock lock(&mu_);
     if (free_epoll1_handles_list_.empty()) {
-      new_handle = new Epoll1EventHandle(fd, this);
+      new_handle = new Epoll1EventHandle(fd, track_err, this);
     } else {
       new_handle = reinterpret_cast<Epoll1EventHandle*>(
           free_epoll1_handles_list_.front());
       free_epoll1_handles_list_.pop_front();
-      new_handle->ReInit(fd);
+      new_handle->ReInit(fd, track_err);
+    }
+    // If no thread is blocked in epoll_wait, the next poll cycle flushes the
+    // pending registrations before it waits, so the syscall need not be made
+    // inline. This matters when connections are accepted in bursts: many of
+    // them are registered together right before the wait, and short lived
+    // ones that are orphaned before that never touch the epoll set at all.
+    if (batch_registrations_ &&
+        num_pollers_in_wait_.load(std::memory_order_relaxed) == 0) {
+      new_handle->RegistrationPending() = true;
+      new_handle->PendingRegistrationIndex() = pending_registrations_.size();
+      pending_registrations_.push_back(new_handle);
+      registration_deferred = true;
     }
   }
   ForkFdListAddHandle(new_handle);
+  if (!registration_deferred) {
+    AddToEpollSet(new_handle);
+  }
+  return new_handle;
+}
+
+void Epoll1Poller::AddToEpollSet(Epoll1EventHandle* handle) {
   struct epoll_event ev;
   ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLOUT | EPOLLET);
   // Use the least significant bit of ev.data.ptr to store track_err. We expect
@@ -417,14 +471,40 @@ EventHandle* Epoll1Poller::CreateHandle(int fd, absl::string_view /*name*/,
   // synchronization issues when accessing it after receiving an event.
   // Accessing fd would be a data race there because the fd might have been
   // returned to the free list at that point.
-  ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_handle) |
-                                        (track_err ? 1 : 0));
-  if (epoll_ctl(g_epoll_set_.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+  ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(handle) |
+                                        (handle->TrackErr() ? 1 : 0));
+  grpc_core::global_stats().IncrementSyscallEpollCtl();
+  if (epoll_ctl(g_epoll_set_.epfd, EPOLL_CTL_ADD, handle->WrappedFd(), &ev) !=
+      0) {
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s",
             grpc_core::StrError(errno).c_str());
   }
+}
 
-  return new_handle;
+void Epoll1Poller::FlushPendingRegistrationsLocked() {
+  for (Epoll1EventHandle* handle : pending_registrations_) {
+    handle->RegistrationPending() = false;
+    AddToEpollSet(handle);
+  }
+  pending_registrations_.clear();
+}
+
+bool Epoll1Poller::CancelPendingRegistration(Epoll1EventHandle* handle) {
+  if (!batch_registrations_) return false;
+  grpc_core::MutexLock lock(&mu_);
+  if (!handle->RegistrationPending()) return false;
+  handle->RegistrationPending() = false;
+  size_t index = handle->PendingRegistrationIndex();
+  if (index >= pending_registrations_.size() ||
+      pending_registrations_[index] != handle) {
+    return false;
+  }
+  // Order does not matter to the flush, so fill the hole with the last entry.
+  Epoll1EventHandle* last = pending_registrations_.back();
+  pending_registrations_[index] = last;
+  last->PendingRegistrationIndex() = index;
+  pending_registrations_.pop_back();
+  return true;
 }
 
 // Process the epoll events found by DoEpollWait() function.
@@ -472,12 +552,22 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
+  if (batch_registrations_) {
+    // Registrations deferred by CreateHandle must be in the epoll set before
+    // we wait. Handles created while we are blocked are registered inline.
+    grpc_core::MutexLock lock(&mu_);
+    FlushPendingRegistrationsLocked();
+    num_pollers_in_wait_.fetch_add(1, std::memory_order_relaxed);
+  }
   int r;
   do {
     r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
                    static_cast<int>(
                        grpc_event_engine::experimental::Milliseconds(timeout)));
   } while (r < 0 && errno == EINTR);
+  if (batch_registrations_) {
+    num_pollers_in_wait_.fetch_sub(1, std::memory_order_relaxed);
+  }
   if (r < 0) {
     grpc_core::Crash(absl::StrFormat(
         "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s", this,
@@ -595,7 +685,8 @@ namespace experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */)
+    : batch_registrations_(false) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -16,9 +16,11 @@
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_EPOLL1_LINUX_H
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
@@ -94,6 +96,17 @@ class Epoll1Poller : public PosixEventPoller, public Forkable {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+
+  // Issue the EPOLL_CTL_ADD for a handle.
+  void AddToEpollSet(Epoll1EventHandle* handle);
+  // Add all handles whose registration was deferred by CreateHandle() to the
+  // epoll set. Called right before epoll_wait so that the registrations
+  // become visible to the wait.
+  void FlushPendingRegistrationsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // If the registration of the handle is still deferred, drop it and return
+  // true. In that case the fd was never added to the epoll set and must not
+  // be removed from it either.
+  bool CancelPendingRegistration(Epoll1EventHandle* handle);
   class HandlesList {
    public:
     explicit HandlesList(Epoll1EventHandle* handle) : handle(handle) {}
@@ -125,6 +138,15 @@ class Epoll1Poller : public PosixEventPoller, public Forkable {
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
+  // If true, handles created while no thread is blocked in epoll_wait are not
+  // registered inline. Their EPOLL_CTL_ADD is deferred to the start of the
+  // next poll cycle, and skipped altogether if the handle is orphaned first.
+  const bool batch_registrations_;
+  // Handles whose EPOLL_CTL_ADD has been deferred to the next poll cycle.
+  std::vector<Epoll1EventHandle*> pending_registrations_ ABSL_GUARDED_BY(mu_);
+  // Number of threads currently blocked in epoll_wait. Only incremented with
+  // mu_ held, right after pending registrations have been flushed.
+  std::atomic<int> num_pollers_in_wait_{0};
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
 };
@@ -20,7 +20,6 @@
 
 #include "absl/status/status.h"
 
-#include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
@@ -38,12 +37,13 @@
 //      closure ptr       : The closure to be executed when the fd has an I/O
 //                          event of interest
 
-//      shutdown_error | kShutdownBit :
-//                         'shutdown_error' field ORed with kShutdownBit.
-//                          This indicates that the fd is shutdown. Since all
+//      kShutdownBit      : The fd is shutdown. The error it was shut down
+//                          with lives in 'shutdown_error', as the heap pointer
+//                          of the status ORed with kShutdownBit. Since all
 //                          memory allocations are word-aligned, the lower two
-//                          bits of the shutdown_error pointer are always 0. So
-//                          it is safe to OR these with kShutdownBit
+//                          bits of the pointer are always 0. So it is safe to
+//                          OR these with kShutdownBit, which also tells an
+//                          OK shutdown status apart from no shutdown at all.
 
 //    Valid state transitions:
 
@@ -53,12 +53,21 @@
 //        |  +--------------4----------+   6    +---------2---------------+  |
 //        |                                |                                 |
 //        |                                v                                 |
-//        +-----5------->  [shutdown_error | kShutdownBit] <-------7---------+
+//        +-----5------->          [kShutdownBit]          <-------7---------+
 
 //     For 1, 4 : See SetReady() function
 //     For 2, 3 : See NotifyOn() function
 //     For 5,6,7: See SetShutdown() function
 
+//    kShutdownBit is terminal, and NotifyOn has at most one caller at a time,
+//    so the only transitions that can race with NotifyOn are 1 and 5/6/7, and
+//    the only ones that can race with SetReady are 3 and 5/6/7. Each CAS below
+//    therefore fails at most a couple of times before the operation completes.
+//    SetShutdown does not CAS on 'state' at all: the first caller claims
+//    'shutdown_error' and then moves 'state' to kShutdownBit with a single
+//    exchange, so shutting down a connection that is hot for reads is
+//    wait-free instead of retrying against every SetReady/NotifyOn.
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -69,24 +78,22 @@ void LockfreeEvent::InitEvent() {
   // state, while a file descriptor is on a freelist. In such a state it may
   // be SetReady'd, and so we need to perform an atomic operation here to
   // ensure no races
+  shutdown_error_.store(0, std::memory_order_relaxed);
   state_.store(kClosureNotReady, std::memory_order_relaxed);
 }
 
 void LockfreeEvent::DestroyEvent() {
-  intptr_t curr;
-  do {
-    curr = state_.load(std::memory_order_relaxed);
-    if (curr & kShutdownBit) {
-      grpc_core::internal::StatusFreeHeapPtr(curr & ~kShutdownBit);
-    } else {
-      GPR_ASSERT(curr == kClosureNotReady || curr == kClosureReady);
-    }
-    // we CAS in a shutdown, no error value here. If this event is interacted
-    // with post-deletion (see the note in the constructor) we want the bit
-    // pattern to prevent error retention in a deleted object
-  } while (!state_.compare_exchange_strong(curr, kShutdownBit,
-                                           std::memory_order_acq_rel,
-                                           std::memory_order_relaxed));
+  intptr_t shutdown_error =
+      shutdown_error_.exchange(0, std::memory_order_acq_rel);
+  if (shutdown_error != 0) {
+    grpc_core::internal::StatusFreeHeapPtr(shutdown_error & ~kShutdownBit);
+  }
+  // We leave the event shutdown, with no error value. If this event is
+  // interacted with post-deletion (see the note in InitEvent) we want the bit
+  // pattern to prevent error retention in a deleted object
+  intptr_t curr = state_.exchange(kShutdownBit, std::memory_order_acq_rel);
+  GPR_ASSERT(curr == kClosureNotReady || curr == kClosureReady ||
+             curr == kShutdownBit);
 }
 
 void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
@@ -110,7 +117,7 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
         // barrier.
         if (state_.compare_exchange_strong(
                 curr, reinterpret_cast<intptr_t>(closure),
-                std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                std::memory_order_acq_rel, std::memory_order_acquire)) {
           return;  // Successful. Return
         }
 
@@ -128,7 +135,7 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
         // is no other code that needs to 'happen-after' this)
         if (state_.compare_exchange_strong(curr, kClosureNotReady,
                                            std::memory_order_acq_rel,
-                                           std::memory_order_relaxed)) {
+                                           std::memory_order_acquire)) {
           scheduler_->Run(closure);
           return;  // Successful. Return.
         }
@@ -136,12 +143,15 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
       }
 
       default: {
-        // 'curr' is either a closure or the fd is shutdown(in which case 'curr'
-        // contains a pointer to the shutdown-error). If the fd is shutdown,
-        // schedule the closure with the shutdown error
+        // 'curr' is either a closure or the fd is shutdown. If the fd is
+        // shutdown, schedule the closure with the shutdown error. The acquire
+        // load (or failed CAS) of 'state' that observed the shutdown pairs
+        // with the release in SetShutdown, so the shutdown error is visible
+        // here.
         if ((curr & kShutdownBit) > 0) {
-          absl::Status shutdown_err =
-              grpc_core::internal::StatusGetFromHeapPtr(curr & ~kShutdownBit);
+          absl::Status shutdown_err = grpc_core::internal::StatusGetFromHeapPtr(
+              shutdown_error_.load(std::memory_order_relaxed) &
+              ~kShutdownBit);
           closure->SetStatus(shutdown_err);
           scheduler_->Run(closure);
           return;
@@ -159,56 +169,33 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
 }
 
 bool LockfreeEvent::SetShutdown(absl::Status shutdown_error) {
+  // A destroyed event is left shutdown with no error, so check 'state' too.
+  if ((state_.load(std::memory_order_acquire) & kShutdownBit) > 0) {
+    return false;
+  }
   intptr_t status_ptr = grpc_core::internal::StatusAllocHeapPtr(shutdown_error);
-  gpr_atm new_state = status_ptr | kShutdownBit;
-  // The load() needs to be performed only once before entry
-  // into the loop. This is because if any of the compare_exchange_strong
-  // operations inside the loop return false, they automatically update curr
-  // with the new value. So it doesn't need to be loaded again.
-  intptr_t curr = state_.load(std::memory_order_acquire);
-
-  while (true) {
-    switch (curr) {
-      case kClosureReady:
-      case kClosureNotReady:
-        // Need a full barrier here so that the initial load in notify_on
-        // doesn't need a barrier
-        if (state_.compare_exchange_strong(curr, new_state,
-                                           std::memory_order_acq_rel,
-                                           std::memory_order_relaxed)) {
-          return true;  // early out
-        }
-        break;  // retry
-
-      default: {
-        // 'curr' is either a closure or the fd is already shutdown
-
-        // If fd is already shutdown, we are done.
-        if ((curr & kShutdownBit) > 0) {
-          grpc_core::internal::StatusFreeHeapPtr(status_ptr);
-          return false;
-        }
-
-        // Fd is not shutdown. Schedule the closure and move the state to
-        // shutdown state.
-        // Needs an acquire to pair with setting the closure (and get a
-        // happens-after on that edge), and a release to pair with anything
-        // loading the shutdown state.
-        if (state_.compare_exchange_strong(curr, new_state,
-                                           std::memory_order_acq_rel,
-                                           std::memory_order_relaxed)) {
-          auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
-          closure->SetStatus(shutdown_error);
-          scheduler_->Run(closure);
-          return true;
-        }
-        // 'curr' was a closure but now changed to a different state. We will
-        // have to retry
-        break;
-      }
-    }
+  // Only the first caller gets to install its error. Racing callers are all
+  // shutting down the same fd, so the losers are done.
+  intptr_t expected = 0;
+  if (!shutdown_error_.compare_exchange_strong(
+          expected, status_ptr | kShutdownBit, std::memory_order_acq_rel,
+          std::memory_order_relaxed)) {
+    grpc_core::internal::StatusFreeHeapPtr(status_ptr);
+    return false;
+  }
+  // Needs an acquire to pair with setting the closure (and get a
+  // happens-after on that edge), and a release to pair with anything loading
+  // the shutdown state (and through it, the shutdown error).
+  intptr_t curr = state_.exchange(kShutdownBit, std::memory_order_acq_rel);
+  if (curr != kClosureNotReady && curr != kClosureReady) {
+    // 'curr' was a closure that is no longer reachable from 'state'. Schedule
+    // it with the shutdown error.
+    GPR_DEBUG_ASSERT((curr & kShutdownBit) == 0);
+    auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
+    closure->SetStatus(shutdown_error);
+    scheduler_->Run(closure);
   }
-  GPR_UNREACHABLE_CODE(return false);
+  return true;
 }
 
 void LockfreeEvent::SetReady() {
@@ -64,6 +64,10 @@ class LockfreeEvent {
   enum State { kClosureNotReady = 0, kClosureReady = 2, kShutdownBit = 1 };
 
   std::atomic<intptr_t> state_;
+  // Heap pointer to the status passed to the first SetShutdown call, or 0.
+  // Kept out of state_ so that shutting down is a single exchange on state_
+  // rather than a CAS loop racing with SetReady and NotifyOn.
+  std::atomic<intptr_t> shutdown_error_{0};
   Scheduler* scheduler_;
 };
 
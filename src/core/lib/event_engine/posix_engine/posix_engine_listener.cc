@@ -46,6 +46,14 @@
 namespace grpc_event_engine {
 namespace experimental {
 
+namespace {
+// Maximum number of connections accepted in one go before the acceptor yields
+// to other work queued on the event engine. Without a bound, a reconnect storm
+// keeps the accepting thread busy handing out new connections while reads and
+// writes on established connections wait behind it.
+constexpr int kMaxAcceptsPerNotification = 64;
+}  // namespace
+
 PosixEngineListenerImpl::PosixEngineListenerImpl(
     PosixEventEngineWithFdSupport::PosixAcceptCallback on_accept,
     absl::AnyInvocable<void(absl::Status)> on_shutdown,
@@ -125,8 +133,24 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     Unref();
     return;
   }
-  // loop until accept4 returns EAGAIN, and then re-arm notification.
-  for (;;) {
+  // loop until accept4 returns EAGAIN, and then re-arm notification. After
+  // kMaxAcceptsPerNotification connections, continue the loop from a fresh
+  // event engine closure instead, so that closures already queued for
+  // established connections get to run first. The socket is edge-triggered,
+  // so the notification must not be re-armed until accept4 fails with EAGAIN.
+  for (int num_accepted = 0;; ++num_accepted) {
+    if (num_accepted == kMaxAcceptsPerNotification) {
+      engine_->Run([this]() {
+        if (handle_->IsHandleShutdown()) {
+          // Shutting down the acceptor. Unref the ref grabbed in
+          // AsyncConnectionAcceptor::Start().
+          Unref();
+          return;
+        }
+        NotifyOnAccept(absl::OkStatus());
+      });
+      return;
+    }
     EventEngine::ResolvedAddress addr;
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     // Note: If we ever decide to return this address to the user, remember to
@@ -58,6 +58,35 @@ const char* const description_schedule_cancellation_over_write =
     "Allow cancellation op to be scheduled over a write";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
+const char* const description_event_engine_batched_epoll_registration =
+    "If set, the epoll1 poller defers epoll_ctl registration of new fds to the "
+    "start of the next poll cycle when no thread is blocked in epoll_wait, and "
+    "skips it entirely for fds that are closed before then.";
+const char* const description_tcp_rpc_latency_breakdown =
+    "If set, chttp2 collects TCP timestamps for the writes of every call that "
+    "has a CallTracer, records how long each write spent queued in gRPC, in "
+    "the kernel, before reaching the network device and waiting for the peer's "
+    "ACK, and reports the breakdown as a call tracer annotation and to the "
+    "stats histograms.";
+const char* const description_sharded_completion_queue =
+    "If set, completion queues of type GRPC_CQ_NEXT keep completed events in "
+    "per-thread shards, so threads draining the same queue mostly pop from "
+    "their own shard and only steal from the others when it is empty.";
+const char* const description_call_arena_pooling =
+    "Recycle the initial arena block of finished calls for new calls on the "
+    "same channel, instead of freeing and reallocating it for every call.";
+const char* const description_promise_based_unary_fast_path =
+    "Client promise based calls close the send pipe as soon as the final "
+    "message has been accepted by the pipe, instead of waiting for the message "
+    "to be acknowledged, saving a round of wakeups on unary calls.";
+const char* const description_wrr_batched_scheduler =
+    "weighted_round_robin precomputes one cycle of picks into a table, so that "
+    "every pick is a table lookup. Weights are rounded to at least 1/64 of the "
+    "max weight, which is coarser than the default scheduler.";
+const char* const description_event_engine_client_no_backup_poller =
+    "If set, the client channel backup poller is not started while the "
+    "EventEngine client is in use. Only safe if nothing else the channels "
+    "depend on, such as the c-ares resolver, still relies on iomgr polling.";
 }  // namespace
 
 namespace grpc_core {
@@ -82,6 +111,16 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"schedule_cancellation_over_write",
      description_schedule_cancellation_over_write, false},
     {"trace_record_callops", description_trace_record_callops, false},
+    {"event_engine_batched_epoll_registration",
+     description_event_engine_batched_epoll_registration, false},
+    {"tcp_rpc_latency_breakdown", description_tcp_rpc_latency_breakdown, false},
+    {"sharded_completion_queue", description_sharded_completion_queue, false},
+    {"call_arena_pooling", description_call_arena_pooling, false},
+    {"promise_based_unary_fast_path", description_promise_based_unary_fast_path,
+     false},
+    {"wrr_batched_scheduler", description_wrr_batched_scheduler, false},
+    {"event_engine_client_no_backup_poller",
+     description_event_engine_client_no_backup_poller, false},
 };
 
 }  // namespace grpc_core
@@ -74,6 +74,13 @@ inline bool IsTransportSuppliesClientLatencyEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 inline bool IsTraceRecordCallopsEnabled() { return false; }
+inline bool IsEventEngineBatchedEpollRegistrationEnabled() { return false; }
+inline bool IsTcpRpcLatencyBreakdownEnabled() { return false; }
+inline bool IsShardedCompletionQueueEnabled() { return false; }
+inline bool IsCallArenaPoolingEnabled() { return false; }
+inline bool IsPromiseBasedUnaryFastPathEnabled() { return false; }
+inline bool IsWrrBatchedSchedulerEnabled() { return false; }
+inline bool IsEventEngineClientNoBackupPollerEnabled() { return false; }
 #else
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() { return IsExperimentEnabled(0); }
@@ -115,8 +122,32 @@ inline bool IsScheduleCancellationOverWriteEnabled() {
 }
 #define GRPC_EXPERIMENT_IS_INCLUDED_TRACE_RECORD_CALLOPS
 inline bool IsTraceRecordCallopsEnabled() { return IsExperimentEnabled(14); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_BATCHED_EPOLL_REGISTRATION
+inline bool IsEventEngineBatchedEpollRegistrationEnabled() {
+  return IsExperimentEnabled(15);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TCP_RPC_LATENCY_BREAKDOWN
+inline bool IsTcpRpcLatencyBreakdownEnabled() {
+  return IsExperimentEnabled(16);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_SHARDED_COMPLETION_QUEUE
+inline bool IsShardedCompletionQueueEnabled() {
+  return IsExperimentEnabled(17);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CALL_ARENA_POOLING
+inline bool IsCallArenaPoolingEnabled() { return IsExperimentEnabled(18); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_PROMISE_BASED_UNARY_FAST_PATH
+inline bool IsPromiseBasedUnaryFastPathEnabled() {
+  return IsExperimentEnabled(19);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_WRR_BATCHED_SCHEDULER
+inline bool IsWrrBatchedSchedulerEnabled() { return IsExperimentEnabled(20); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT_NO_BACKUP_POLLER
+inline bool IsEventEngineClientNoBackupPollerEnabled() {
+  return IsExperimentEnabled(21);
+}
 
-constexpr const size_t kNumExperiments = 15;
+constexpr const size_t kNumExperiments = 22;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 #endif
@@ -0,0 +1,102 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_RCU_H
+#define GRPC_SRC_CORE_LIB_GPRPP_RCU_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>
+
+#include "src/core/lib/gprpp/per_cpu.h"
+
+namespace grpc_core {
+
+// A read-copy-update domain: readers access shared data inside a
+// ReadSection without locking, and writers that unpublish data call
+// Synchronize() before freeing it, which waits until every ReadSection that
+// might still see the data has ended.
+//
+// Readers announce themselves in a per-CPU counter. They alternate between
+// two counter generations, so that a steady stream of new readers cannot keep
+// Synchronize() waiting.
+//
+// Read sections must be short and must not block (in particular, they must
+// not wait for anything that may be waiting in Synchronize()). They require
+// an ExecCtx on the stack. Calls to Synchronize() must be serialized by the
+// caller, and must not be made from inside a read section.
+class Rcu {
+ public:
+  class ReadSection {
+   public:
+    explicit ReadSection(Rcu* rcu)
+        : readers_(&rcu->readers_.this_cpu()
+                        .count[rcu->generation_.load(
+                                   std::memory_order_relaxed) &
+                               1]) {
+      // seq_cst so that this becomes visible to a writer before the section
+      // can load any of the data the writer is about to unpublish.
+      readers_->fetch_add(1, std::memory_order_seq_cst);
+    }
+    ~ReadSection() { readers_->fetch_sub(1, std::memory_order_release); }
+
+    ReadSection(const ReadSection&) = delete;
+    ReadSection& operator=(const ReadSection&) = delete;
+
+   private:
+    std::atomic<intptr_t>* const readers_;
+  };
+
+  // Waits until no read section that started before the call is still
+  // running. Data unpublished (with seq_cst stores) before the call can be
+  // freed once it returns.
+  void Synchronize() {
+    // Readers may be counted in either generation, so drain both: after
+    // flipping, new readers only join the other one.
+    for (int i = 0; i < 2; ++i) {
+      const uintptr_t generation =
+          generation_.fetch_add(1, std::memory_order_seq_cst);
+      WaitForReaders(generation & 1);
+    }
+  }
+
+ private:
+  // Padded to a cache line so that readers on different CPUs do not contend.
+  struct Readers {
+    std::atomic<intptr_t> count[2] = {{0}, {0}};
+    char padding[GPR_CACHELINE_SIZE - 2 * sizeof(std::atomic<intptr_t>)];
+  };
+
+  void WaitForReaders(uintptr_t generation) {
+    while (true) {
+      intptr_t readers = 0;
+      for (const Readers& cpu : readers_) {
+        readers += cpu.count[generation].load(std::memory_order_seq_cst);
+      }
+      if (readers == 0) return;
+      // Read sections are short: the readers are gone momentarily.
+      std::this_thread::yield();
+    }
+  }
+
+  std::atomic<uintptr_t> generation_{0};
+  PerCpu<Readers> readers_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_RCU_H
@@ -0,0 +1,76 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_RCU_REF_COUNTED_PTR_H
+#define GRPC_SRC_CORE_LIB_GPRPP_RCU_REF_COUNTED_PTR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <utility>
+
+#include "src/core/lib/gprpp/rcu.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// Holds a RefCountedPtr<T> that any number of threads can take refs to
+// without locking, while one writer at a time replaces it.
+//
+// Get() loads the pointer and refs it inside an Rcu read section. Set() swaps
+// the pointer and then waits for the read sections that might still be
+// reffing the old value to end, after which it hands the old value back to
+// the caller.
+//
+// Get() must be called with an ExecCtx on the stack. Calls to Set() must be
+// serialized by the caller, and must not be made while the calling thread is
+// itself inside Get().
+template <typename T>
+class RcuRefCountedPtr {
+ public:
+  RcuRefCountedPtr() = default;
+  explicit RcuRefCountedPtr(RefCountedPtr<T> value)
+      : value_(value.release()) {}
+  ~RcuRefCountedPtr() {
+    T* value = value_.load(std::memory_order_relaxed);
+    if (value != nullptr) value->Unref();
+  }
+
+  RcuRefCountedPtr(const RcuRefCountedPtr&) = delete;
+  RcuRefCountedPtr& operator=(const RcuRefCountedPtr&) = delete;
+
+  // Returns a new ref to the current value.
+  RefCountedPtr<T> Get() {
+    Rcu::ReadSection read_section(&rcu_);
+    T* value = value_.load(std::memory_order_seq_cst);
+    if (value == nullptr) return nullptr;
+    return value->Ref();
+  }
+
+  // Replaces the value and returns the previous one, which no reader can
+  // still be taking a ref to.
+  RefCountedPtr<T> Set(RefCountedPtr<T> value) {
+    T* old = value_.exchange(value.release(), std::memory_order_seq_cst);
+    rcu_.Synchronize();
+    return RefCountedPtr<T>(old);
+  }
+
+ private:
+  std::atomic<T*> value_{nullptr};
+  Rcu rcu_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_RCU_REF_COUNTED_PTR_H
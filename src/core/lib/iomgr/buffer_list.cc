@@ -309,6 +309,10 @@ void grpc_tcp_set_write_timestamps_callback(
     void (*fn)(void*, Timestamps*, grpc_error_handle error)) {
   g_timestamps_callback = fn;
 }
+
+bool grpc_tcp_write_timestamps_callback_is_set() {
+  return g_timestamps_callback != DefaultTimestampsCallback;
+}
 }  // namespace grpc_core
 
 #else  // GRPC_LINUX_ERRQUEUE
@@ -322,6 +326,8 @@ void grpc_tcp_set_write_timestamps_callback(
   (void)fn;
   gpr_log(GPR_DEBUG, "Timestamps callback is not enabled for this platform");
 }
+
+bool grpc_tcp_write_timestamps_callback_is_set() { return false; }
 }  // namespace grpc_core
 
 #endif  // GRPC_LINUX_ERRQUEUE
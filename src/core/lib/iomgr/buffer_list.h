@@ -180,6 +180,10 @@ class TracedBufferList {
 void grpc_tcp_set_write_timestamps_callback(
     void (*fn)(void*, Timestamps*, grpc_error_handle error));
 
+/// Returns true if a callback has been set with
+/// grpc_tcp_set_write_timestamps_callback().
+bool grpc_tcp_write_timestamps_callback_is_set();
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_IOMGR_BUFFER_LIST_H
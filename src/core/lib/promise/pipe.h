@@ -179,10 +179,14 @@ class Center : public InterceptorList<T> {
     }
     GPR_DEBUG_ASSERT(refs_ != 0);
     switch (value_state_) {
-      case ValueState::kClosed:
       case ValueState::kReadyClosed:
-      case ValueState::kCancelled:
+        // After CloseBehindPush() the queued value is acked once the receiver
+        // has taken it, unless the receiver has gone away.
+        if (ack_after_close_ && !receiver_closed_) return on_empty_.pending();
         return false;
+      case ValueState::kClosed:
+      case ValueState::kCancelled:
+        return ack_after_close_ && value_taken_after_close_;
       case ValueState::kReady:
       case ValueState::kEmpty:
         return on_empty_.pending();
@@ -210,6 +214,10 @@ class Center : public InterceptorList<T> {
       case ValueState::kReadyClosed:
         this->ResetInterceptorList();
         value_state_ = ValueState::kClosed;
+        if (ack_after_close_) {
+          value_taken_after_close_ = true;
+          on_empty_.Wake();
+        }
         ABSL_FALLTHROUGH_INTENDED;
       case ValueState::kReady:
         return std::move(value_);
@@ -232,6 +240,10 @@ class Center : public InterceptorList<T> {
       case ValueState::kReadyClosed:
         this->ResetInterceptorList();
         value_state_ = ValueState::kClosed;
+        if (ack_after_close_) {
+          value_taken_after_close_ = true;
+          on_empty_.Wake();
+        }
         break;
       case ValueState::kClosed:
       case ValueState::kCancelled:
@@ -263,6 +275,24 @@ class Center : public InterceptorList<T> {
     }
   }
 
+  // Close the send side, but unlike MarkClosed() let a value that is still
+  // queued be acked once the receiver takes it.
+  void MarkClosedBehindPush() {
+    ack_after_close_ = true;
+    MarkClosed();
+  }
+
+  // Called when the receiver goes away. After MarkClosedBehindPush(), a value
+  // that is still queued will never be taken, so a push waiting for its ack
+  // fails.
+  void MarkReceiverClosed() {
+    if (ack_after_close_) {
+      receiver_closed_ = true;
+      on_empty_.Wake();
+    }
+    MarkClosed();
+  }
+
   void MarkCancelled() {
     if (grpc_trace_promise_primitives.enabled()) {
       gpr_log(GPR_INFO, "%s", DebugOpString("MarkCancelled").c_str());
@@ -274,6 +304,7 @@ class Center : public InterceptorList<T> {
       case ValueState::kReadyClosed:
         this->ResetInterceptorList();
         value_state_ = ValueState::kCancelled;
+        if (ack_after_close_) on_empty_.Wake();
         on_full_.Wake();
         break;
       case ValueState::kClosed:
@@ -347,6 +378,13 @@ class Center : public InterceptorList<T> {
   uint8_t refs_;
   // Current state of the value.
   ValueState value_state_;
+  // Set by MarkClosedBehindPush(): a value queued behind the close
+  // (kReadyClosed) is acked once taken, instead of failing its push.
+  bool ack_after_close_ = false;
+  // Set when the value queued behind the close has been taken.
+  bool value_taken_after_close_ = false;
+  // Set once the receiver has been destroyed.
+  bool receiver_closed_ = false;
   IntraActivityWaiter on_empty_;
   IntraActivityWaiter on_full_;
 
@@ -380,6 +418,17 @@ class PipeSender {
     }
   }
 
+  // Like Close(), but a value that was pushed and is still waiting for the
+  // receiver is acked once the receiver takes it, rather than failing its
+  // push. Used by the promise based unary fast path, which half-closes right
+  // behind the call's last message.
+  void CloseBehindPush() {
+    if (center_ != nullptr) {
+      center_->MarkClosedBehindPush();
+      center_.reset();
+    }
+  }
+
   void Swap(PipeSender<T>* other) { std::swap(center_, other->center_); }
 
   // Send a single message along the pipe.
@@ -418,7 +467,7 @@ class PipeReceiver {
   PipeReceiver(PipeReceiver&& other) noexcept = default;
   PipeReceiver& operator=(PipeReceiver&& other) noexcept = default;
   ~PipeReceiver() {
-    if (center_ != nullptr) center_->MarkClosed();
+    if (center_ != nullptr) center_->MarkReceiverClosed();
   }
 
   void Swap(PipeReceiver<T>* other) { std::swap(center_, other->center_); }
@@ -478,6 +527,10 @@ class Push {
     return center_->PollAck();
   }
 
+  // True once the value has been handed to the pipe and this promise is only
+  // waiting for the receiver to acknowledge it.
+  bool pushed() const { return absl::holds_alternative<AwaitingAck>(state_); }
+
  private:
   struct AwaitingAck {};
 
@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <new>
+#include <utility>
 
 #include <grpc/support/alloc.h>
 
@@ -29,11 +30,15 @@
 
 namespace {
 
-void* ArenaStorage(size_t initial_size) {
+// Size of the block backing an arena with an initial zone of \a initial_size.
+size_t ArenaStorageSize(size_t initial_size) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
-  initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
-  size_t alloc_size = base_size + initial_size;
+  return base_size + GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
+}
+
+void* ArenaStorage(size_t initial_size) {
+  size_t alloc_size = ArenaStorageSize(initial_size);
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
@@ -62,11 +67,16 @@ Arena* Arena::Create(size_t initial_size, MemoryAllocator* memory_allocator) {
 }
 
 std::pair<Arena*, void*> Arena::CreateWithAlloc(
-    size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator) {
+    size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator,
+    ArenaStoragePool* storage_pool) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
-  auto* new_arena = new (ArenaStorage(initial_size))
-      Arena(initial_size, alloc_size, memory_allocator);
+  initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
+  void* storage =
+      storage_pool == nullptr ? nullptr : storage_pool->Get(&initial_size);
+  if (storage == nullptr) storage = ArenaStorage(initial_size);
+  auto* new_arena = new (storage)
+      Arena(initial_size, alloc_size, memory_allocator, storage_pool);
   void* first_alloc = reinterpret_cast<char*>(new_arena) + base_size;
   return std::make_pair(new_arena, first_alloc);
 }
@@ -83,8 +93,12 @@ void Arena::Destroy() {
     }
   }
   memory_allocator_->Release(total_allocated_.load(std::memory_order_relaxed));
+  ArenaStoragePool* storage_pool = storage_pool_;
+  const size_t initial_size = initial_zone_size_;
   this->~Arena();
-  gpr_free_aligned(this);
+  if (storage_pool == nullptr || !storage_pool->Put(this, initial_size)) {
+    gpr_free_aligned(this);
+  }
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -162,4 +176,60 @@ void Arena::FreePooled(void* p, std::atomic<FreePoolNode*>* head) {
   }
 }
 
+ArenaStoragePool::~ArenaStoragePool() {
+  Block* block = free_list_.exchange(nullptr, std::memory_order_acquire);
+  while (block != nullptr) {
+    Free(std::exchange(block, block->next));
+  }
+}
+
+void* ArenaStoragePool::Get(size_t* initial_size) {
+  // Same ABA mitigation as AllocPooled: take the whole list, keep the head and
+  // give the rest back, re-pushing anything that was freed concurrently.
+  Block* block = free_list_.exchange(nullptr, std::memory_order_acquire);
+  if (block == nullptr) return nullptr;
+  if (block->next != nullptr) {
+    Block* extra = free_list_.exchange(block->next, std::memory_order_acq_rel);
+    while (extra != nullptr) {
+      Push(std::exchange(extra, extra->next));
+    }
+  }
+  num_cached_blocks_.fetch_sub(1, std::memory_order_relaxed);
+  if (block->initial_size < *initial_size) {
+    // Our estimate grew since this block was cached: it's too small to be of
+    // use any more.
+    Free(block);
+    return nullptr;
+  }
+  *initial_size = block->initial_size;
+  // The block now belongs to an arena again, which like any other arena does
+  // not account for its initial block.
+  memory_allocator_->Release(ArenaStorageSize(block->initial_size));
+  return block;
+}
+
+bool ArenaStoragePool::Put(void* storage, size_t initial_size) {
+  if (num_cached_blocks_.fetch_add(1, std::memory_order_relaxed) >=
+      max_cached_blocks_) {
+    num_cached_blocks_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  memory_allocator_->Reserve(ArenaStorageSize(initial_size));
+  Push(new (storage) Block{nullptr, initial_size});
+  return true;
+}
+
+void ArenaStoragePool::Push(Block* block) {
+  block->next = free_list_.load(std::memory_order_acquire);
+  while (!free_list_.compare_exchange_weak(block->next, block,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+  }
+}
+
+void ArenaStoragePool::Free(Block* block) {
+  memory_allocator_->Release(ArenaStorageSize(block->initial_size));
+  gpr_free_aligned(block);
+}
+
 }  // namespace grpc_core
@@ -113,6 +113,48 @@ PoolAndSize ChoosePoolForAllocationSize(
 
 }  // namespace arena_detail
 
+// Caches the initial blocks of destroyed arenas so that they can back new
+// arenas. Owners that create and destroy many similarly sized arenas (such as
+// a channel creating calls) use this to skip a malloc/free pair per arena.
+// Cached blocks stay reserved against \a memory_allocator until they are
+// reused or freed, so that the resource quota sees them.
+class ArenaStoragePool {
+ public:
+  explicit ArenaStoragePool(MemoryAllocator* memory_allocator,
+                            size_t max_cached_blocks = 64)
+      : memory_allocator_(memory_allocator),
+        max_cached_blocks_(max_cached_blocks) {}
+  ~ArenaStoragePool();
+
+  ArenaStoragePool(const ArenaStoragePool&) = delete;
+  ArenaStoragePool& operator=(const ArenaStoragePool&) = delete;
+
+ private:
+  friend class Arena;
+
+  struct Block {
+    Block* next;
+    size_t initial_size;
+  };
+
+  // Returns a cached block able to back an arena with an initial zone of at
+  // least *initial_size bytes, updating *initial_size to the block's actual
+  // initial zone size. Returns nullptr if no such block is cached.
+  void* Get(size_t* initial_size);
+  // Caches \a storage, the block of an arena with an initial zone of
+  // \a initial_size bytes. Returns false if the pool is full, in which case
+  // the caller still owns \a storage.
+  bool Put(void* storage, size_t initial_size);
+  void Push(Block* block);
+  // Frees a cached block and releases its reservation.
+  void Free(Block* block);
+
+  MemoryAllocator* const memory_allocator_;
+  const size_t max_cached_blocks_;
+  std::atomic<size_t> num_cached_blocks_{0};
+  std::atomic<Block*> free_list_{nullptr};
+};
+
 class Arena {
   using PoolSizes = absl::integer_sequence<size_t, 256, 512, 768>;
   struct FreePoolNode {
@@ -126,9 +168,11 @@ class Arena {
   // Create an arena, with \a initial_size bytes in the first allocated buffer,
   // and return both a void pointer to the returned arena and a void* with the
   // first allocation.
+  // If \a storage_pool is non-null the arena's initial block is taken from
+  // and returned to that pool when possible; the pool must outlive the arena.
   static std::pair<Arena*, void*> CreateWithAlloc(
-      size_t initial_size, size_t alloc_size,
-      MemoryAllocator* memory_allocator);
+      size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator,
+      ArenaStoragePool* storage_pool = nullptr);
 
   // Destroy an arena.
   void Destroy();
@@ -266,10 +310,12 @@ class Arena {
   //   where we wish to create an arena and then perform an immediate
   //   allocation.
   explicit Arena(size_t initial_size, size_t initial_alloc,
-                 MemoryAllocator* memory_allocator)
+                 MemoryAllocator* memory_allocator,
+                 ArenaStoragePool* storage_pool = nullptr)
       : total_used_(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_alloc)),
         initial_zone_size_(initial_size),
-        memory_allocator_(memory_allocator) {}
+        memory_allocator_(memory_allocator),
+        storage_pool_(storage_pool) {}
 
   ~Arena();
 
@@ -293,6 +339,8 @@ class Arena {
   std::atomic<FreePoolNode*> pools_[PoolSizes::size()]{};
   // The backing memory quota
   MemoryAllocator* const memory_allocator_;
+  // Where to return our initial block on destruction, if anywhere.
+  ArenaStoragePool* const storage_pool_;
 };
 
 // Smart pointer for arenas when the final size is not required.
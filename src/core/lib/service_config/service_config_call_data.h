@@ -21,10 +21,10 @@
 
 #include <stddef.h>
 
-#include <map>
 #include <memory>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -40,7 +40,33 @@ namespace grpc_core {
 /// easily access method and global parameters for the call.
 class ServiceConfigCallData {
  public:
-  using CallAttributes = std::map<UniqueTypeName, absl::string_view>;
+  // Attributes set on the call for use by LB policies.  A call has only a
+  // handful of them, so they are stored inline and searched linearly
+  // instead of being kept in a map, which would allocate on every call.
+  class CallAttributes {
+   public:
+    // Returns the value of the attribute, or an empty string if not set.
+    absl::string_view Get(UniqueTypeName name) const {
+      for (const auto& attribute : attributes_) {
+        if (attribute.first == name) return attribute.second;
+      }
+      return absl::string_view();
+    }
+
+    void Set(UniqueTypeName name, absl::string_view value) {
+      for (auto& attribute : attributes_) {
+        if (attribute.first == name) {
+          attribute.second = value;
+          return;
+        }
+      }
+      attributes_.emplace_back(name, value);
+    }
+
+   private:
+    absl::InlinedVector<std::pair<UniqueTypeName, absl::string_view>, 4>
+        attributes_;
+  };
 
   ServiceConfigCallData() : method_configs_(nullptr) {}
 
@@ -68,7 +94,7 @@ class ServiceConfigCallData {
   // Must be called when holding the call combiner (legacy filter) or from
   // inside the activity (promise-based filter).
   void SetCallAttribute(UniqueTypeName name, absl::string_view value) {
-    call_attributes_[name] = value;
+    call_attributes_.Set(name, value);
   }
 
  private:
@@ -720,7 +720,8 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       channel_stack->call_stack_size;
 
   std::pair<Arena*, void*> arena_with_call = Arena::CreateWithAlloc(
-      initial_size, call_alloc_size, channel->allocator());
+      initial_size, call_alloc_size, channel->allocator(),
+      IsCallArenaPoolingEnabled() ? channel->call_arena_pool() : nullptr);
   arena = arena_with_call.first;
   call = new (arena_with_call.second) FilterStackCall(arena, *args);
   GPR_DEBUG_ASSERT(FromC(call->c_ptr()) == call);
@@ -2285,6 +2286,11 @@ class PromiseBasedCall : public Call,
   bool is_sending() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     return outstanding_send_.has_value();
   }
+  // True if the outstanding send's message is already in the pipe, and only
+  // its ack is still awaited.
+  bool is_send_pushed() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return outstanding_send_.has_value() && outstanding_send_->pushed();
+  }
 
  private:
   union CompletionInfo {
@@ -2414,8 +2420,9 @@ grpc_error_handle MakePromiseBasedCall(grpc_call_create_args* args,
                                        grpc_call** out_call) {
   Channel* channel = args->channel.get();
 
-  auto alloc = Arena::CreateWithAlloc(channel->CallSizeEstimate(), sizeof(T),
-                                      channel->allocator());
+  auto alloc = Arena::CreateWithAlloc(
+      channel->CallSizeEstimate(), sizeof(T), channel->allocator(),
+      IsCallArenaPoolingEnabled() ? channel->call_arena_pool() : nullptr);
   PromiseBasedCall* call = new (alloc.second) T(alloc.first, args);
   *out_call = call->c_ptr();
   GPR_DEBUG_ASSERT(Call::FromC(*out_call) == call);
@@ -3026,8 +3033,20 @@ void ClientPromiseBasedCall::UpdateOnce() {
     Finish(ServerMetadataFromStatus(absl::Status(
         absl::StatusCode::kInternal, "Failed to send message to server")));
   }
-  if (!is_sending() && close_send_completion_.has_value()) {
-    client_to_server_messages_.sender.Close();
+  // Unary fast path: once the client has half-closed, the last message needs
+  // no flow control, so close the pipe right behind it (the receiver still
+  // gets the message, then end of stream) rather than waiting for the ack and
+  // another wakeup. The send itself still completes on the ack, once the
+  // receiver has taken the message.
+  const bool close_behind_send =
+      IsPromiseBasedUnaryFastPathEnabled() && is_send_pushed();
+  if ((!is_sending() || close_behind_send) &&
+      close_send_completion_.has_value()) {
+    if (close_behind_send) {
+      client_to_server_messages_.sender.CloseBehindPush();
+    } else {
+      client_to_server_messages_.sender.Close();
+    }
     FinishOpOnCompletion(&close_send_completion_,
                          PendingOp::kSendCloseFromClient);
   }
@@ -76,6 +76,7 @@ Channel::Channel(bool is_client, bool is_promising, std::string target,
       allocator_(channel_args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryOwner(target)),
+      call_arena_pool_(&allocator_),
       target_(std::move(target)),
       channel_stack_(std::move(channel_stack)) {
   // We need to make sure that grpc_shutdown() does not shut things down
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <atomic>
 #include <initializer_list>
+#include <memory>
 #include <new>
 #include <string>
 #include <utility>
@@ -37,13 +38,16 @@
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/atomic_utils.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -225,10 +229,14 @@ namespace {
 // Queue that holds the cq_completion_events. Internally uses
 // MultiProducerSingleConsumerQueue (a lockfree multiproducer single consumer
 // queue). It uses a queue_lock to support multiple consumers.
+// With the sharded_completion_queue experiment, it is split into several such
+// queues. Each thread pushes to and pops from its own shard first, and only
+// steals from the other shards when that one is empty, so that many threads
+// draining the same queue do not all contend on a single queue_lock.
 // Only used in completion queues whose completion_type is GRPC_CQ_NEXT
 class CqEventQueue {
  public:
-  CqEventQueue() = default;
+  CqEventQueue();
   ~CqEventQueue() = default;
 
   // Note: The counter is not incremented/decremented atomically with push/pop.
@@ -241,10 +249,21 @@ class CqEventQueue {
   grpc_cq_completion* Pop();
 
  private:
-  // Spinlock to serialize consumers i.e pop() operations
-  gpr_spinlock queue_lock_ = GPR_SPINLOCK_INITIALIZER;
+  struct Shard {
+    // Spinlock to serialize consumers i.e pop() operations
+    gpr_spinlock queue_lock = GPR_SPINLOCK_INITIALIZER;
 
-  grpc_core::MultiProducerSingleConsumerQueue queue_;
+    grpc_core::MultiProducerSingleConsumerQueue queue;
+  };
+
+  // Upper bound on the number of shards, regardless of the number of cores.
+  static constexpr size_t kMaxShards = 16;
+
+  // Returns the index of the shard the calling thread uses first.
+  size_t HomeShard() const;
+
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
 
   // A lazy counter of number of items in the queue. This is NOT atomically
   // incremented/decremented along with push/pop operations and hence is only
@@ -481,8 +500,23 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
   return ret;
 }
 
+CqEventQueue::CqEventQueue()
+    : num_shards_(grpc_core::IsShardedCompletionQueueEnabled()
+                      ? grpc_core::Clamp<size_t>(gpr_cpu_num_cores(), 1,
+                                                 kMaxShards)
+                      : 1),
+      shards_(new Shard[num_shards_]) {}
+
+size_t CqEventQueue::HomeShard() const {
+  if (num_shards_ == 1) return 0;
+  static std::atomic<size_t> next_thread_index{0};
+  static thread_local size_t thread_index =
+      next_thread_index.fetch_add(1, std::memory_order_relaxed);
+  return thread_index % num_shards_;
+}
+
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
+  shards_[HomeShard()].queue.Push(
       reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
   return num_queue_items_.fetch_add(1, std::memory_order_relaxed) == 0;
 }
@@ -490,10 +524,17 @@ bool CqEventQueue::Push(grpc_cq_completion* c) {
 grpc_cq_completion* CqEventQueue::Pop() {
   grpc_cq_completion* c = nullptr;
 
-  if (gpr_spinlock_trylock(&queue_lock_)) {
-    bool is_empty = false;
-    c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
-    gpr_spinlock_unlock(&queue_lock_);
+  // Start with the calling thread's own shard, then steal from the others.
+  const size_t home_shard = HomeShard();
+  for (size_t i = 0; i < num_shards_ && c == nullptr; ++i) {
+    if (i > 0 && num_items() == 0) break;
+    Shard& shard = shards_[(home_shard + i) % num_shards_];
+    if (gpr_spinlock_trylock(&shard.queue_lock)) {
+      bool is_empty = false;
+      c = reinterpret_cast<grpc_cq_completion*>(
+          shard.queue.PopAndCheckEnd(&is_empty));
+      gpr_spinlock_unlock(&shard.queue_lock);
+    }
   }
 
   if (c) {
@@ -941,22 +982,16 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
+// Blocks until the first event is available (or the deadline passes / the
+// queue shuts down) and stores it in events[0]. If that event is a completion,
+// up to max_events - 1 further completions that are already queued are popped
+// into the rest of \a events without polling again. Returns the number of
+// events written.
+static int cq_next_internal(grpc_completion_queue* cq, gpr_timespec deadline,
+                            grpc_event* events, int max_events) {
   grpc_event ret;
   cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
-  GPR_ASSERT(!reserved);
-
   dump_pending_tags(cq);
 
   GRPC_CQ_INTERNAL_REF(cq, "next");
@@ -1051,6 +1086,25 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     is_finished_arg.first_loop = false;
   }
 
+  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  events[0] = ret;
+  int num_events = 1;
+  if (ret.type == GRPC_OP_COMPLETE) {
+    // Drain completions that are already queued. A NULL pop (empty queue or
+    // transient inconsistency) just ends the batch; the kick below hands any
+    // leftovers to another poller.
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      grpc_event* ev = &events[num_events++];
+      ev->type = GRPC_OP_COMPLETE;
+      ev->success = c->next & 1u;
+      ev->tag = c->tag;
+      c->done(c->done_arg, c);
+      GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, ev);
+    }
+  }
+
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.load(std::memory_order_acquire) > 0) {
     gpr_mu_lock(cq->mu);
@@ -1058,11 +1112,28 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GPR_ASSERT(is_finished_arg.stolen_completion == nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+  GPR_ASSERT(!reserved);
+
+  grpc_event ret;
+  cq_next_internal(cq, deadline, &ret, 1);
   return ret;
 }
 
@@ -1113,6 +1184,25 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                     grpc_event* events, int max_events,
+                                     gpr_timespec deadline, void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, events=%p, max_events=%d, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  GPR_ASSERT(!reserved);
+  GPR_ASSERT(cq->vtable->cq_completion_type == GRPC_CQ_NEXT);
+  GPR_ASSERT(events != nullptr);
+  GPR_ASSERT(max_events > 0);
+  return cq_next_internal(cq, deadline, events, max_events);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -239,9 +239,14 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
+    std::queue<PendingCall> pending;
+    {
+      MutexLock lock(&mu_);
+      pending.swap(pending_);
+    }
+    while (!pending.empty()) {
       Match(
-          pending_.front(),
+          pending.front(),
           [](CallData* calld) {
             calld->SetState(CallData::CallState::ZOMBIED);
             calld->KillZombie();
@@ -249,7 +254,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
           [](const std::shared_ptr<ActivityWaiter>& w) {
             w->Finish(absl::InternalError("Server closed"));
           });
-      pending_.pop();
+      pending.pop();
     }
   }
 
@@ -279,7 +284,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       auto pop_next_pending = [this, request_queue_index] {
         NextPendingCall pending_call;
         {
-          MutexLock lock(&server_->mu_call_);
+          MutexLock lock(&mu_);
           if (!pending_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
@@ -324,14 +329,14 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // this matcher's lock to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
     {
-      MutexLock lock(&server_->mu_call_);
+      MutexLock lock(&mu_);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -362,14 +367,14 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // this matcher's lock to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
     {
-      MutexLock lock(&server_->mu_call_);
+      MutexLock lock(&mu_);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -409,7 +414,11 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     std::atomic<absl::StatusOr<MatchResult>*> result{nullptr};
   };
   using PendingCall = absl::variant<CallData*, std::shared_ptr<ActivityWaiter>>;
-  std::queue<PendingCall> pending_;
+  // Guards pending_ and orders it against the request queues. Each matcher
+  // (i.e. each registered method, plus the unregistered matcher) has its own
+  // lock, so calls to different methods never contend here.
+  Mutex mu_;
+  std::queue<PendingCall> pending_ ABSL_GUARDED_BY(mu_);
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
@@ -20,6 +20,9 @@
 
 #include "src/core/lib/surface/validate_metadata.h"
 
+#include <stdint.h>
+#include <string.h>
+
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 
@@ -31,25 +34,76 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/error.h"
 
+namespace {
+
+// Byte-parallel (SWAR) range checks over eight bytes held in a uint64_t.
+// These only give exact per-byte answers for bytes below 0x80; callers reject
+// words with any high bit set first.
+constexpr uint64_t kOnes = 0x0101010101010101ull;
+constexpr uint64_t kHighBits = 0x8080808080808080ull;
+
+// High bit of each byte set iff that byte is >= lo (lo <= 0x80). Setting the
+// high bit before subtracting keeps borrows from crossing bytes.
+constexpr uint64_t BytesAtLeast(uint64_t x, uint8_t lo) {
+  return ((x | kHighBits) - kOnes * lo) & kHighBits;
+}
+
+// High bit of each byte set iff lo <= byte <= hi (hi < 0x80).
+constexpr uint64_t BytesInRange(uint64_t x, uint8_t lo, uint8_t hi) {
+  return BytesAtLeast(x, lo) & ~BytesAtLeast(x, hi + 1);
+}
+
+bool HeaderKeyWordIsLegal(uint64_t x) {
+  if ((x & kHighBits) != 0) return false;
+  return (BytesInRange(x, 'a', 'z') | BytesInRange(x, '0', '9') |
+          BytesInRange(x, '-', '.') | BytesInRange(x, '_', '_')) == kHighBits;
+}
+
+bool HeaderNonBinValueWordIsLegal(uint64_t x) {
+  if ((x & kHighBits) != 0) return false;
+  return BytesInRange(x, 32, 126) == kHighBits;
+}
+
+// Returns the first byte of [p, e) not in legal_bits, or e. Whole words are
+// screened with word_is_legal; the table handles the tail and pinpoints the
+// offending byte within a rejected word.
+template <typename WordIsLegal>
+const uint8_t* FindIllegalByte(const uint8_t* p, const uint8_t* e,
+                               const grpc_core::BitSet<256>& legal_bits,
+                               WordIsLegal word_is_legal) {
+  for (; e - p >= 8; p += 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    if (!word_is_legal(word)) break;
+  }
+  for (; p != e; p++) {
+    if (!legal_bits.is_set(*p)) break;
+  }
+  return p;
+}
+
+}  // namespace
+
+template <typename WordIsLegal>
 static grpc_error_handle conforms_to(const grpc_slice& slice,
                                      const grpc_core::BitSet<256>& legal_bits,
+                                     WordIsLegal word_is_legal,
                                      const char* err_desc) {
-  const uint8_t* p = GRPC_SLICE_START_PTR(slice);
-  const uint8_t* e = GRPC_SLICE_END_PTR(slice);
-  for (; p != e; p++) {
-    if (!legal_bits.is_set(*p)) {
-      size_t len;
-      grpc_core::UniquePtr<char> ptr(gpr_dump_return_len(
-          reinterpret_cast<const char*> GRPC_SLICE_START_PTR(slice),
-          GRPC_SLICE_LENGTH(slice), GPR_DUMP_HEX | GPR_DUMP_ASCII, &len));
-      grpc_error_handle error = grpc_error_set_str(
-          grpc_error_set_int(GRPC_ERROR_CREATE(err_desc),
-                             grpc_core::StatusIntProperty::kOffset,
-                             p - GRPC_SLICE_START_PTR(slice)),
-          grpc_core::StatusStrProperty::kRawBytes,
-          absl::string_view(ptr.get(), len));
-      return error;
-    }
+  const uint8_t* p = FindIllegalByte(GRPC_SLICE_START_PTR(slice),
+                                     GRPC_SLICE_END_PTR(slice), legal_bits,
+                                     word_is_legal);
+  if (p != GRPC_SLICE_END_PTR(slice)) {
+    size_t len;
+    grpc_core::UniquePtr<char> ptr(gpr_dump_return_len(
+        reinterpret_cast<const char*> GRPC_SLICE_START_PTR(slice),
+        GRPC_SLICE_LENGTH(slice), GPR_DUMP_HEX | GPR_DUMP_ASCII, &len));
+    grpc_error_handle error = grpc_error_set_str(
+        grpc_error_set_int(GRPC_ERROR_CREATE(err_desc),
+                           grpc_core::StatusIntProperty::kOffset,
+                           p - GRPC_SLICE_START_PTR(slice)),
+        grpc_core::StatusStrProperty::kRawBytes,
+        absl::string_view(ptr.get(), len));
+    return error;
   }
   return absl::OkStatus();
 }
@@ -83,7 +137,8 @@ grpc_error_handle grpc_validate_header_key_is_legal(const grpc_slice& slice) {
   if (GRPC_SLICE_START_PTR(slice)[0] == ':') {
     return GRPC_ERROR_CREATE("Metadata keys cannot start with :");
   }
-  return conforms_to(slice, g_legal_header_key_bits, "Illegal header key");
+  return conforms_to(slice, g_legal_header_key_bits, HeaderKeyWordIsLegal,
+                     "Illegal header key");
 }
 
 int grpc_header_key_is_legal(grpc_slice slice) {
@@ -105,7 +160,7 @@ constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
   return conforms_to(slice, g_legal_header_non_bin_value_bits,
-                     "Illegal header value");
+                     HeaderNonBinValueWordIsLegal, "Illegal header value");
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
@@ -1286,6 +1286,9 @@ class MetadataMap {
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
+  // As Copy(), but allocates the copy's storage on \a arena instead of on this
+  // map's arena, for copies that must outlive it.
+  Derived Copy(Arena* arena) const;
   bool empty() const { return table_.empty() && unknown_.empty(); }
   size_t count() const { return table_.count() + unknown_.size(); }
 
@@ -1348,7 +1351,12 @@ size_t MetadataMap<Derived, Traits...>::TransportSize() const {
 
 template <typename Derived, typename... Traits>
 Derived MetadataMap<Derived, Traits...>::Copy() const {
-  Derived out(unknown_.arena());
+  return Copy(unknown_.arena());
+}
+
+template <typename Derived, typename... Traits>
+Derived MetadataMap<Derived, Traits...>::Copy(Arena* arena) const {
+  Derived out(arena);
   metadata_detail::CopySink<Derived> sink(&out);
   ForEach(&sink);
   return out;
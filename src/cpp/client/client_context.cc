@@ -65,6 +65,7 @@ ClientContext::ClientContext()
     : initial_metadata_received_(false),
       wait_for_ready_(false),
       wait_for_ready_explicitly_set_(false),
+      inline_reactors_(false),
       call_(nullptr),
       call_canceled_(false),
       deadline_(gpr_inf_future(GPR_CLOCK_REALTIME)),
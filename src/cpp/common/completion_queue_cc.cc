@@ -15,6 +15,7 @@
 //
 //
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -162,6 +163,43 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, int max_events, gpr_timespec deadline,
+    int* num_events) {
+  constexpr int kMaxNextBatchSize = 64;
+  GPR_ASSERT(max_events > 0);
+  max_events = std::min(max_events, kMaxNextBatchSize);
+  grpc_event events[kMaxNextBatchSize];
+  for (;;) {
+    int num_core_events = grpc_completion_queue_next_batch(
+        cq_, events, max_events, deadline, nullptr);
+    int num_results = 0;
+    for (int i = 0; i < num_core_events; i++) {
+      // TIMEOUT and SHUTDOWN are only ever returned on their own.
+      switch (events[i].type) {
+        case GRPC_QUEUE_TIMEOUT:
+          return TIMEOUT;
+        case GRPC_QUEUE_SHUTDOWN:
+          return SHUTDOWN;
+        case GRPC_OP_COMPLETE:
+          break;
+      }
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void** tag = &tags[num_results];
+      bool* ok = &oks[num_results];
+      *ok = events[i].success != 0;
+      *tag = core_cq_tag;
+      if (core_cq_tag->FinalizeResult(tag, ok)) ++num_results;
+    }
+    // If every event was an internal one, keep waiting up to the deadline.
+    if (num_results > 0) {
+      *num_events = num_results;
+      return GOT_EVENT;
+    }
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -164,6 +164,21 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::EnableInlineCallbackReactors() {
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_INLINE_CALLBACK_REACTORS, 1);
+}
+
+void ServerBuilder::experimental_type::SetSyncServerWorkQueueSize(
+    int max_queued_rpcs) {
+  builder_->AddChannelArgument(GRPC_ARG_SYNC_SERVER_WORK_QUEUE_SIZE,
+                               max_queued_rpcs);
+}
+
+void ServerBuilder::experimental_type::SetSyncServerMaxWorkers(
+    int max_workers) {
+  builder_->AddChannelArgument(GRPC_ARG_SYNC_SERVER_MAX_WORKERS, max_workers);
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -644,6 +644,7 @@ class Server::CallbackRequest final
                            req_->server_->call_metric_recording_enabled(),
                            req_->server_->server_metric_recorder());
       req_->ctx_->cq_ = req_->cq_;
+      req_->ctx_->inline_reactors_ = req_->server_->inline_callback_reactors_;
       req_->ctx_->BindDeadlineAndMetadata(req_->deadline_,
                                           &req_->request_metadata_);
       req_->request_metadata_.count = 0;
@@ -778,8 +779,10 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
-      : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
+                           int max_pollers, int cq_timeout_msec,
+                           int max_queued_work, int max_workers)
+      : ThreadManager("SyncServer", rq, min_pollers, max_pollers,
+                      max_queued_work, max_workers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
@@ -910,10 +913,24 @@ Server::Server(
       default_rq_created = true;
     }
 
+    int max_queued_work = 0;
+    int max_workers = -1;
+    grpc_channel_args sync_args = args->c_channel_args();
+    for (size_t i = 0; i < sync_args.num_args; i++) {
+      if (0 == strcmp(sync_args.args[i].key,
+                      GRPC_ARG_SYNC_SERVER_WORK_QUEUE_SIZE)) {
+        max_queued_work = sync_args.args[i].value.integer;
+      } else if (0 == strcmp(sync_args.args[i].key,
+                             GRPC_ARG_SYNC_SERVER_MAX_WORKERS) &&
+                 sync_args.args[i].value.integer > 0) {
+        max_workers = sync_args.args[i].value.integer;
+      }
+    }
+
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, max_queued_work, max_workers));
     }
 
     if (default_rq_created) {
@@ -947,6 +964,10 @@ Server::Server(
                     GRPC_ARG_SERVER_CALL_METRIC_RECORDING)) {
       call_metric_recording_enabled_ = channel_args.args[i].value.integer;
     }
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_SERVER_INLINE_CALLBACK_REACTORS)) {
+      inline_callback_reactors_ = channel_args.args[i].value.integer != 0;
+    }
   }
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
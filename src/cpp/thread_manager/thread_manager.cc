@@ -20,11 +20,15 @@
 
 #include <climits>
 #include <initializer_list>
+#include <utility>
 
 #include "absl/strings/str_format.h"
 
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/thd.h"
@@ -32,8 +36,9 @@
 
 namespace grpc {
 
-ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
-    : thd_mgr_(thd_mgr) {
+ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr,
+                                          bool queue_worker)
+    : thd_mgr_(thd_mgr), queue_worker_(queue_worker) {
   // Make thread creation exclusive with respect to its join happening in
   // ~WorkerThread().
   thd_ = grpc_core::Thread(
@@ -46,7 +51,13 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 }
 
 void ThreadManager::WorkerThread::Run() {
-  thd_mgr_->MainWorkLoop();
+  if (queue_worker_) {
+    thd_mgr_->QueueWorkLoop();
+  } else if (thd_mgr_->queued_mode()) {
+    thd_mgr_->QueuePollLoop();
+  } else {
+    thd_mgr_->MainWorkLoop();
+  }
   thd_mgr_->MarkAsCompleted(this);
 }
 
@@ -56,7 +67,8 @@ ThreadManager::WorkerThread::~WorkerThread() {
 }
 
 ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
-                             int min_pollers, int max_pollers)
+                             int min_pollers, int max_pollers,
+                             int max_queued_work, int max_workers)
     : shutdown_(false),
       thread_quota_(
           grpc_core::ResourceQuota::FromC(resource_quota)->thread_quota()),
@@ -64,7 +76,9 @@ ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
-      max_active_threads_sofar_(0) {}
+      max_active_threads_sofar_(0),
+      max_queued_work_(max_queued_work),
+      max_workers_(max_workers == -1 ? INT_MAX : max_workers) {}
 
 ThreadManager::~ThreadManager() {
   {
@@ -85,6 +99,8 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  // Idle queue workers exit once they see the queue is empty.
+  work_cv_.SignalAll();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -142,7 +158,7 @@ void ThreadManager::Initialize() {
   }
 
   for (int i = 0; i < min_pollers_; i++) {
-    WorkerThread* worker = new WorkerThread(this);
+    WorkerThread* worker = new WorkerThread(this, /*queue_worker=*/false);
     GPR_ASSERT(worker->created());  // Must be able to create the minimum
     worker->Start();
   }
@@ -182,7 +198,8 @@ void ThreadManager::MainWorkLoop() {
             }
             // Drop lock before spawning thread to avoid contention
             lock.Release();
-            WorkerThread* worker = new WorkerThread(this);
+            WorkerThread* worker =
+                new WorkerThread(this, /*queue_worker=*/false);
             if (worker->created()) {
               worker->Start();
             } else {
@@ -264,4 +281,111 @@ void ThreadManager::MainWorkLoop() {
   // enough threads.
 }
 
+void ThreadManager::QueuePollLoop() {
+  while (true) {
+    void* tag;
+    bool ok;
+    WorkStatus work_status = PollForWork(&tag, &ok);
+    if (work_status == SHUTDOWN) break;
+    // Pollers never shrink or grow in queued mode, so a timeout only matters
+    // if the thread manager is shutting down.
+    if (work_status == TIMEOUT) {
+      if (IsShutdown()) break;
+      continue;
+    }
+    EnqueueWork(tag, ok);
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    num_pollers_--;
+  }
+  CleanupCompletedThreads();
+}
+
+void ThreadManager::EnqueueWork(void* tag, bool ok) {
+  grpc_core::ReleasableMutexLock lock(&mu_);
+  if (shutdown_) {
+    // The workers may already have drained the queue and exited, so do the
+    // work here: the poller keeps going until the work source runs dry.
+    lock.Release();
+    DoWork(tag, ok, true);
+    return;
+  }
+  if (static_cast<int>(work_queue_.size()) >= max_queued_work_) {
+    lock.Release();
+    grpc_core::global_stats().IncrementSyncServerRequestsRejected();
+    DoWork(tag, ok, false);
+    return;
+  }
+  // Add a worker unless an idle one is going to pick this work up, or the
+  // pool is already at its limit, in which case the work waits in the queue.
+  bool add_worker = false;
+  if (num_idle_workers_ <= static_cast<int>(work_queue_.size()) &&
+      num_workers_ < max_workers_ && thread_quota_->Reserve(1)) {
+    add_worker = true;
+    num_workers_++;
+    num_threads_++;
+    if (num_threads_ > max_active_threads_sofar_) {
+      max_active_threads_sofar_ = num_threads_;
+    }
+  }
+  if (num_workers_ == 0) {
+    // There is nobody to do the work and no quota for a thread that could.
+    lock.Release();
+    grpc_core::global_stats().IncrementSyncServerRequestsRejected();
+    DoWork(tag, ok, false);
+    return;
+  }
+  work_queue_.push_back(QueuedWork{tag, ok, gpr_now(GPR_CLOCK_MONOTONIC)});
+  work_cv_.Signal();
+  // Drop lock before spawning thread to avoid contention
+  lock.Release();
+  if (!add_worker) return;
+  WorkerThread* worker = new WorkerThread(this, /*queue_worker=*/true);
+  if (worker->created()) {
+    worker->Start();
+    return;
+  }
+  delete worker;
+  std::deque<QueuedWork> stranded;
+  {
+    grpc_core::MutexLock failure_lock(&mu_);
+    num_workers_--;
+    num_threads_--;
+    // Without any worker, nothing would ever pick up the queued work.
+    if (num_workers_ == 0) stranded.swap(work_queue_);
+  }
+  thread_quota_->Release(1);
+  for (const QueuedWork& work : stranded) {
+    grpc_core::global_stats().IncrementSyncServerRequestsRejected();
+    DoWork(work.tag, work.ok, false);
+  }
+}
+
+void ThreadManager::QueueWorkLoop() {
+  grpc_core::LockableAndReleasableMutexLock lock(&mu_);
+  while (true) {
+    while (work_queue_.empty() && !shutdown_) {
+      num_idle_workers_++;
+      work_cv_.Wait(&mu_);
+      num_idle_workers_--;
+    }
+    // Queued work is drained even after shutdown.
+    if (work_queue_.empty()) break;
+    QueuedWork work = work_queue_.front();
+    work_queue_.pop_front();
+    lock.Release();
+    grpc_core::global_stats().IncrementSyncServerQueueDelayUs(
+        static_cast<int>(gpr_timespec_to_micros(
+            gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), work.enqueued))));
+    DoWork(work.tag, work.ok, true);
+    lock.Lock();
+    // Keep at most max_pollers_ idle workers around.
+    if (work_queue_.empty() && num_idle_workers_ >= max_pollers_) break;
+  }
+  num_workers_--;
+  lock.Release();
+  CleanupCompletedThreads();
+}
+
 }  // namespace grpc
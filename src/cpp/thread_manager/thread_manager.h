@@ -19,8 +19,11 @@
 #ifndef GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 #define GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 
+#include <deque>
 #include <list>
 
+#include <grpc/support/time.h>
+
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/resource_quota/api.h"
@@ -28,10 +31,24 @@
 
 namespace grpc {
 
+// By default, every thread of a ThreadManager alternates between polling for
+// work and doing it, and the number of threads grows and shrinks between
+// min_pollers and max_pollers idle pollers.
+//
+// If max_queued_work is positive, the ThreadManager instead runs a fixed set
+// of min_pollers poller threads that only poll, and hands the work they find
+// to a separate pool of worker threads through a queue of at most
+// max_queued_work items. A worker is added whenever work is queued and no
+// worker is idle, as long as there are fewer than max_workers workers (-1
+// means no limit) and the thread quota permits. Beyond that, work waits in the
+// queue, and up to max_pollers idle workers are kept around. Work that finds
+// the queue full is rejected: it is passed to DoWork() with
+// resources == false on the poller thread.
 class ThreadManager {
  public:
   explicit ThreadManager(const char* name, grpc_resource_quota* resource_quota,
-                         int min_pollers, int max_pollers);
+                         int min_pollers, int max_pollers,
+                         int max_queued_work = 0, int max_workers = -1);
   virtual ~ThreadManager();
 
   // Initializes and Starts the Rpc Manager threads
@@ -117,30 +134,50 @@ class ThreadManager {
   // not be called (and the need for this WorkerThread class is eliminated)
   class WorkerThread {
    public:
-    explicit WorkerThread(ThreadManager* thd_mgr);
+    // If queue_worker is true, the thread serves the work queue instead of
+    // polling.
+    WorkerThread(ThreadManager* thd_mgr, bool queue_worker);
     ~WorkerThread();
 
     bool created() const { return created_; }
     void Start() { thd_.Start(); }
 
    private:
-    // Calls thd_mgr_->MainWorkLoop() and once that completes, calls
-    // thd_mgr_>MarkAsCompleted(this) to mark the thread as completed
+    // Calls thd_mgr_->MainWorkLoop() (or thd_mgr_->QueueWorkLoop() for queue
+    // workers) and once that completes, calls thd_mgr_>MarkAsCompleted(this)
+    // to mark the thread as completed
     void Run();
 
     ThreadManager* const thd_mgr_;
+    const bool queue_worker_;
     grpc_core::Thread thd_;
     bool created_;
   };
 
+  // A unit of work found by a poller and waiting in work_queue_
+  struct QueuedWork {
+    void* tag;
+    bool ok;
+    gpr_timespec enqueued;
+  };
+
+  bool queued_mode() const { return max_queued_work_ > 0; }
+
   // The main function in ThreadManager
   void MainWorkLoop();
 
+  // The main function of pollers and workers when queued_mode()
+  void QueuePollLoop();
+  void QueueWorkLoop();
+
+  // Queues the work found by a poller, or rejects it if the queue is full.
+  void EnqueueWork(void* tag, bool ok);
+
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
-  // Protects shutdown_, num_pollers_, num_threads_ and
-  // max_active_threads_sofar_
+  // Protects shutdown_, num_pollers_, num_threads_,
+  // max_active_threads_sofar_ and the work queue state below
   grpc_core::Mutex mu_;
 
   bool shutdown_;
@@ -170,6 +207,15 @@ class ThreadManager {
   // ever set so far
   int max_active_threads_sofar_;
 
+  // Only used when queued_mode()
+  const int max_queued_work_;
+  const int max_workers_;
+  std::deque<QueuedWork> work_queue_;
+  grpc_core::CondVar work_cv_;
+  // Number of queue workers, and how many of them are waiting for work
+  int num_workers_ = 0;
+  int num_idle_workers_ = 0;
+
   grpc_core::Mutex list_mu_;
   std::list<WorkerThread*> completed_threads_;
 };
@@ -39,10 +39,14 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+    'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
     'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
     'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
+    'src/core/ext/filters/client_channel/lb_policy/p2c_policy.cc',
+    'src/core/ext/filters/client_channel/lb_policy/peak_ewma/peak_ewma.cc',
     'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
     'src/core/ext/filters/client_channel/lb_policy/priority/priority.cc',
+    'src/core/ext/filters/client_channel/lb_policy/ring_hash/hash_ring.cc',
     'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
     'src/core/ext/filters/client_channel/lb_policy/rls/rls.cc',
     'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
@@ -57,6 +61,8 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/lb_policy/xds/xds_override_host.cc',
     'src/core/ext/filters/client_channel/lb_policy/xds/xds_wrr_locality.cc',
     'src/core/ext/filters/client_channel/local_subchannel_pool.cc',
+    'src/core/ext/filters/client_channel/request_coalescing_filter.cc',
+    'src/core/ext/filters/client_channel/request_coalescing_service_config.cc',
     'src/core/ext/filters/client_channel/resolver/binder/binder_resolver.cc',
     'src/core/ext/filters/client_channel/resolver/dns/c_ares/dns_resolver_ares.cc',
     'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_ev_driver_posix.cc',
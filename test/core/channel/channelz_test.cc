@@ -22,6 +22,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -32,6 +34,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/time.h>
 
+#include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz_registry.h"
 #include "src/core/lib/gpr/useful.h"
@@ -524,6 +527,38 @@ TEST(ChannelzServerTest, BasicServerAPIFunctionality) {
   ValidateServer(channelz_server, {3, 3, 3});
 }
 
+std::vector<std::string> GetSubchannelSocketNames(SubchannelNode* subchannel) {
+  std::vector<std::string> names;
+  Json json = subchannel->RenderJson();
+  auto it = json.object_value().find("socketRef");
+  if (it == json.object_value().end()) return names;
+  for (const Json& ref : it->second.array_value()) {
+    names.push_back(ref.object_value().at("name").string_value());
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+TEST(ChannelzSubchannelTest, ListsPooledSockets) {
+  ExecCtx exec_ctx;
+  auto subchannel = MakeRefCounted<SubchannelNode>("ipv4:127.0.0.1:443", 0);
+  auto main_socket = MakeRefCounted<SocketNode>("local", "remote", "main",
+                                                /*security=*/nullptr);
+  auto pooled_socket = MakeRefCounted<SocketNode>("local", "remote", "pooled",
+                                                  /*security=*/nullptr);
+  subchannel->SetChildSocket(main_socket);
+  subchannel->AddPooledChildSocket(pooled_socket);
+  EXPECT_EQ(GetSubchannelSocketNames(subchannel.get()),
+            std::vector<std::string>({"main", "pooled"}));
+  // The pooled socket takes over when the main connection is lost.
+  subchannel->RemovePooledChildSocket(pooled_socket->uuid());
+  subchannel->SetChildSocket(pooled_socket);
+  EXPECT_EQ(GetSubchannelSocketNames(subchannel.get()),
+            std::vector<std::string>({"pooled"}));
+  subchannel->SetChildSocket(nullptr);
+  EXPECT_TRUE(GetSubchannelSocketNames(subchannel.get()).empty());
+}
+
 TEST_F(ChannelzRegistryBasedTest, BasicGetServersTest) {
   ExecCtx exec_ctx;
   ServerFixture server;
@@ -0,0 +1,120 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/backup_poller.h"
+
+#include <string>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/shim.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/iomgr/iomgr.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+constexpr int kBackupPollIntervalMs = 10;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+// Waits until \a channel is READY, trying to connect as needed.
+void WaitForReady(grpc_channel* channel, grpc_completion_queue* cq) {
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(30);
+  grpc_connectivity_state state;
+  while ((state = grpc_channel_check_connectivity_state(
+              channel, /*try_to_connect=*/1)) != GRPC_CHANNEL_READY) {
+    grpc_channel_watch_connectivity_state(channel, state, deadline, cq,
+                                          Tag(1));
+    grpc_event ev = grpc_completion_queue_next(cq, deadline, nullptr);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    ASSERT_TRUE(ev.success) << "timed out waiting for the channel";
+  }
+}
+
+// Idle channels should only be woken up by the backup poller when their
+// connections cannot otherwise make progress.
+TEST(BackupPollerTest, IdleChannelWakeups) {
+  const std::string address =
+      JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  grpc_server_credentials* server_creds =
+      grpc_insecure_server_credentials_create();
+  ASSERT_NE(grpc_server_add_http2_port(server, address.c_str(), server_creds),
+            0);
+  grpc_server_credentials_release(server_creds);
+  grpc_server_start(server);
+  grpc_channel_credentials* channel_creds = grpc_insecure_credentials_create();
+  grpc_channel* channel =
+      grpc_channel_create(address.c_str(), channel_creds, nullptr);
+  grpc_channel_credentials_release(channel_creds);
+  WaitForReady(channel, cq);
+  // Leave the channel idle for many backup poll intervals.
+  auto before = global_stats().Collect();
+  absl::SleepFor(absl::Milliseconds(50 * kBackupPollIntervalMs));
+  auto after = global_stats().Collect();
+  const uint64_t backup_polls =
+      after->client_channel_backup_polls - before->client_channel_backup_polls;
+  if ((IsEventEngineClientNoBackupPollerEnabled() &&
+       grpc_event_engine::experimental::UseEventEngineClient()) ||
+      grpc_iomgr_run_in_background()) {
+    EXPECT_EQ(backup_polls, 0);
+  } else {
+    EXPECT_GT(backup_polls, 0);
+  }
+  grpc_channel_destroy(channel);
+  grpc_server_shutdown_and_notify(server, cq, Tag(2));
+  grpc_event ev = grpc_completion_queue_next(
+      cq, grpc_timeout_seconds_to_deadline(30), nullptr);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  ASSERT_EQ(ev.tag, Tag(2));
+  grpc_server_destroy(server);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  GPR_GLOBAL_CONFIG_SET(grpc_client_channel_backup_poll_interval_ms,
+                        grpc_core::testing::kBackupPollIntervalMs);
+  grpc_init();
+  auto result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/hash_ring.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr uint64_t kMaxHash = std::numeric_limits<uint64_t>::max();
+
+TEST(HashRingTest, SortsEntriesWithTheirSubchannelIndexes) {
+  HashRing ring({30, 10, 40, 20}, {0, 1, 2, 3});
+  ASSERT_EQ(ring.size(), 4u);
+  EXPECT_EQ(ring.hash(0), 10u);
+  EXPECT_EQ(ring.subchannel_index(0), 1u);
+  EXPECT_EQ(ring.hash(1), 20u);
+  EXPECT_EQ(ring.subchannel_index(1), 3u);
+  EXPECT_EQ(ring.hash(2), 30u);
+  EXPECT_EQ(ring.subchannel_index(2), 0u);
+  EXPECT_EQ(ring.hash(3), 40u);
+  EXPECT_EQ(ring.subchannel_index(3), 2u);
+}
+
+TEST(HashRingTest, FindEntryInFirstBucket) {
+  HashRing ring({kMaxHash - 1, uint64_t{1} << 62, 5, 0}, {0, 1, 2, 3});
+  EXPECT_EQ(ring.FindEntry(0), 0u);
+  EXPECT_EQ(ring.FindEntry(1), 1u);
+  EXPECT_EQ(ring.FindEntry(5), 1u);
+  EXPECT_EQ(ring.subchannel_index(ring.FindEntry(5)), 2u);
+  EXPECT_EQ(ring.FindEntry(6), 2u);
+}
+
+TEST(HashRingTest, FindEntryInLastBucket) {
+  HashRing ring({kMaxHash - 1, uint64_t{1} << 62, 5, 0}, {0, 1, 2, 3});
+  EXPECT_EQ(ring.FindEntry((uint64_t{1} << 62) + 1), 3u);
+  EXPECT_EQ(ring.FindEntry(kMaxHash - 1), 3u);
+  EXPECT_EQ(ring.subchannel_index(ring.FindEntry(kMaxHash - 1)), 0u);
+}
+
+TEST(HashRingTest, FindEntryWrapsAroundPastLastEntry) {
+  HashRing ring({uint64_t{1} << 62, uint64_t{3} << 61}, {0, 1});
+  // Past the last entry, in its bucket and in the empty last bucket.
+  EXPECT_EQ(ring.FindEntry((uint64_t{3} << 61) + 1), 0u);
+  EXPECT_EQ(ring.FindEntry(kMaxHash), 0u);
+  // Before the first entry, in the empty first bucket.
+  EXPECT_EQ(ring.FindEntry(0), 0u);
+}
+
+TEST(HashRingTest, SingleEntry) {
+  HashRing ring({uint64_t{1} << 63}, {7});
+  EXPECT_EQ(ring.FindEntry(0), 0u);
+  EXPECT_EQ(ring.FindEntry(uint64_t{1} << 63), 0u);
+  EXPECT_EQ(ring.FindEntry(kMaxHash), 0u);
+  EXPECT_EQ(ring.subchannel_index(0), 7u);
+}
+
+TEST(HashRingTest, FindEntryMatchesBinarySearch) {
+  std::mt19937_64 rng(0);
+  std::vector<uint64_t> hashes = {0, kMaxHash};
+  std::vector<uint32_t> subchannel_indexes = {0, 1};
+  for (uint32_t i = 2; i < 10000; ++i) {
+    hashes.push_back(rng());
+    subchannel_indexes.push_back(i);
+  }
+  std::vector<uint64_t> sorted = hashes;
+  std::sort(sorted.begin(), sorted.end());
+  HashRing ring(hashes, subchannel_indexes);
+  ASSERT_EQ(ring.size(), sorted.size());
+  for (size_t i = 0; i < ring.size(); ++i) {
+    EXPECT_EQ(ring.hash(i), sorted[i]);
+    EXPECT_EQ(hashes[ring.subchannel_index(i)], sorted[i]);
+  }
+  auto expected = [&](uint64_t hash) -> size_t {
+    size_t index =
+        std::lower_bound(sorted.begin(), sorted.end(), hash) - sorted.begin();
+    return index == sorted.size() ? 0 : index;
+  };
+  for (uint64_t hash : hashes) {
+    EXPECT_EQ(ring.FindEntry(hash), expected(hash));
+    EXPECT_EQ(ring.FindEntry(hash + 1), expected(hash + 1));
+  }
+  for (int i = 0; i < 10000; ++i) {
+    const uint64_t hash = rng();
+    EXPECT_EQ(ring.FindEntry(hash), expected(hash));
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -510,6 +510,16 @@ class LoadBalancingPolicyTest : public ::testing::Test {
     const absl::optional<BackendMetricData> backend_metric_data_;
   };
 
+  // Finishes a call that was started with the specified tracker.
+  static void FinishCall(
+      LoadBalancingPolicy::SubchannelCallTrackerInterface* tracker,
+      absl::string_view address, absl::Status status = absl::OkStatus()) {
+    ExecCtx exec_ctx;
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor({});
+    tracker->Finish({address, status, &metadata, &backend_metric_accessor});
+  }
+
   LoadBalancingPolicyTest()
       : work_serializer_(std::make_shared<WorkSerializer>()) {}
 
@@ -738,6 +748,52 @@ class LoadBalancingPolicyTest : public ::testing::Test {
     return retval;
   }
 
+  // Sends an update with the specified addresses and config to a policy
+  // that picks among READY subchannels at random, connects every
+  // subchannel, and returns the first READY picker that returns all of the
+  // addresses.  The calls picked while waiting are never started.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+  ExpectRandomPickerStartup(absl::Span<const absl::string_view> addresses,
+                            Json config, LoadBalancingPolicy* lb_policy,
+                            size_t num_picks = 50,
+                            SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(
+        ApplyUpdate(BuildUpdate(addresses, MakeConfig(config)), lb_policy),
+        absl::OkStatus())
+        << location.file() << ":" << location.line();
+    ExpectConnectingUpdate(location);
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr)
+          << "Address: " << address << " at " << location.file() << ":"
+          << location.line();
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested())
+          << location.file() << ":" << location.line();
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    WaitForStateUpdate(
+        [&](FakeHelper::StateUpdate update) {
+          if (update.state != GRPC_CHANNEL_READY) return true;
+          std::vector<std::unique_ptr<
+              LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+              trackers;
+          auto picks = GetCompletePicks(update.picker.get(), num_picks, {},
+                                        &trackers, location);
+          if (!picks.has_value()) return false;
+          if (std::set<std::string>(picks->begin(), picks->end()).size() <
+              addresses.size()) {
+            return true;
+          }
+          picker = std::move(update.picker);
+          return false;
+        },
+        location);
+    return picker;
+  }
+
   // Expects a state update for the specified state and status, and then
   // expects the resulting picker to queue picks.
   void ExpectStateAndQueuingPicker(
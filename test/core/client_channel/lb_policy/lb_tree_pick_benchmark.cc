@@ -0,0 +1,162 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/variant.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/address_filtering.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+constexpr int kAddressesPerLocality = 4;
+
+// Builds the tree of LB policies that xDS uses for a cluster, with a single
+// priority and the given number of localities:
+//
+// - priority_experimental
+//   - weighted_target_experimental
+//     - leaf_policy (one per locality)
+//
+// and connects all of the addresses, so that picks go through every level
+// of the tree.
+class LbTree : public LoadBalancingPolicyTest {
+ public:
+  LbTree(absl::string_view leaf_policy, int num_localities)
+      : lb_policy_(MakeLbPolicy("priority_experimental")) {
+    LoadBalancingPolicy::UpdateArgs update;
+    update.addresses.emplace();
+    Json::Object targets;
+    for (int i = 0; i < num_localities; ++i) {
+      std::string locality = absl::StrCat("locality", i);
+      for (int j = 0; j < kAddressesPerLocality; ++j) {
+        std::map<const char*,
+                 std::unique_ptr<ServerAddress::AttributeInterface>>
+            attributes;
+        attributes[kHierarchicalPathAttributeKey] =
+            MakeHierarchicalPathAttribute({"p0", locality});
+        update.addresses->emplace_back(
+            MakeAddress(absl::StrCat("ipv4:127.0.0.1:",
+                                     1000 + i * kAddressesPerLocality + j)),
+            ChannelArgs(), std::move(attributes));
+      }
+      targets[std::move(locality)] = Json::Object{
+          {"weight", 1},
+          {"childPolicy", Json::Array{Json::Object{
+                              {std::string(leaf_policy), Json::Object()}}}}};
+    }
+    Json::Object weighted_target = {
+        {"weighted_target_experimental",
+         Json::Object{{"targets", std::move(targets)}}}};
+    update.config = MakeConfig(Json::Array{Json::Object{
+        {"priority_experimental",
+         Json::Object{
+             {"children",
+              Json::Object{{"p0", Json::Object{{"config",
+                                                Json::Array{std::move(
+                                                    weighted_target)}}}}}},
+             {"priorities", Json::Array{"p0"}}}}}});
+    GPR_ASSERT(ApplyUpdate(std::move(update), lb_policy_.get()).ok());
+    for (auto& p : subchannel_pool_) {
+      p.second.SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      p.second.SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    // The last state update has the picker that uses every address.
+    grpc_connectivity_state state = GRPC_CHANNEL_IDLE;
+    while (!helper_->QueueEmpty()) {
+      auto state_update = helper_->GetNextStateUpdate();
+      GPR_ASSERT(state_update.has_value());
+      state = state_update->state;
+      picker_ = std::move(state_update->picker);
+    }
+    GPR_ASSERT(state == GRPC_CHANNEL_READY);
+  }
+
+  ~LbTree() override {
+    ExecCtx exec_ctx;
+    picker_.reset();
+    lb_policy_.reset();
+  }
+
+  void Pick(benchmark::State& state) {
+    ExecCtx exec_ctx;
+    FakeMetadata metadata({});
+    FakeCallState call_state({});
+    for (auto _ : state) {
+      auto result = picker_->Pick({"/service/method", &metadata, &call_state});
+      GPR_ASSERT(absl::holds_alternative<
+                 LoadBalancingPolicy::PickResult::Complete>(result.result));
+    }
+  }
+
+ private:
+  void TestBody() override {}
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
+};
+
+void BM_LbTreePick(benchmark::State& state, absl::string_view leaf_policy) {
+  LbTree lb_tree(leaf_policy, state.range(0));
+  lb_tree.Pick(state);
+}
+BENCHMARK_CAPTURE(BM_LbTreePick, round_robin, "round_robin")
+    ->RangeMultiplier(4)
+    ->Range(1, 16);
+BENCHMARK_CAPTURE(BM_LbTreePick, weighted_round_robin,
+                  "weighted_round_robin_experimental")
+    ->RangeMultiplier(4)
+    ->Range(1, 16);
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,105 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : lb_policy_(MakeLbPolicy("least_request_experimental")) {}
+
+  // Connects all of the addresses and returns a picker that uses all of
+  // them.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    return ExpectRandomPickerStartup(
+        addresses,
+        Json::Array{
+            Json::Object{{"least_request_experimental", Json::Object{}}}},
+        lb_policy_.get());
+  }
+
+  // Picks once, starts the call and returns its tracker.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+  StartCall(LoadBalancingPolicy::SubchannelPicker* picker,
+            absl::optional<std::string>* address) {
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        tracker;
+    *address = ExpectPickComplete(picker, {}, &tracker);
+    EXPECT_NE(tracker, nullptr);
+    if (tracker != nullptr) tracker->Start();
+    return tracker;
+  }
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+};
+
+TEST_F(LeastRequestTest, AvoidsEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Leave a call in flight on whichever address is picked first.  With two
+  // endpoints every pick compares both, so the next picks go to the other.
+  absl::optional<std::string> busy_address;
+  auto tracker = StartCall(picker.get(), &busy_address);
+  ASSERT_NE(tracker, nullptr);
+  ASSERT_TRUE(busy_address.has_value());
+  auto picks = GetCompletePicks(picker.get(), 20);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_NE(address, *busy_address);
+  }
+  // Once the call finishes, both addresses are picked again.
+  FinishCall(tracker.get(), *busy_address);
+  picks = GetCompletePicks(picker.get(), 50);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::set<std::string>(picks->begin(), picks->end()).size(), 2u);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -18,15 +18,24 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -34,12 +43,16 @@
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/event_engine/mock_event_engine.h"
 #include "test/core/util/test_config.h"
 
 namespace grpc_core {
 namespace testing {
 namespace {
 
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MockEventEngine;
+
 class OutlierDetectionTest : public LoadBalancingPolicyTest {
  protected:
   class ConfigBuilder {
@@ -103,6 +116,23 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *this;
     }
 
+    ConfigBuilder& SetLatencyThreshold(uint32_t value) {
+      GetLatency()["threshold"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyEnforcementPercentage(uint32_t value) {
+      GetLatency()["enforcementPercentage"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyMinimumHosts(uint32_t value) {
+      GetLatency()["minimumHosts"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyRequestVolume(uint32_t value) {
+      GetLatency()["requestVolume"] = value;
+      return *this;
+    }
+
     RefCountedPtr<LoadBalancingPolicy::Config> Build() {
       Json config =
           Json::Array{Json::Object{{"outlier_detection_experimental", json_}}};
@@ -121,12 +151,97 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *it->second.mutable_object();
     }
 
+    Json::Object& GetLatency() {
+      auto it = json_.emplace("latencyEjection", Json::Object()).first;
+      return *it->second.mutable_object();
+    }
+
     Json::Object json_;
   };
 
-  OutlierDetectionTest()
-      : lb_policy_(MakeLbPolicy("outlier_detection_experimental")) {}
+  // A custom time cache for which InvalidateCache() is a no-op.  This
+  // ensures that when the timer callback instantiates its own ExecCtx
+  // and therefore its own ScopedTimeCache, it continues to see the time
+  // that we are injecting in the test.
+  class TestTimeCache final : public Timestamp::ScopedSource {
+   public:
+    TestTimeCache() : cached_time_(previous()->Now()) {}
+
+    Timestamp Now() override { return cached_time_; }
+    void InvalidateCache() override {}
+
+    void IncrementBy(Duration duration) { cached_time_ += duration; }
 
+   private:
+    Timestamp cached_time_;
+  };
+
+  OutlierDetectionTest() {
+    mock_ee_ = std::make_shared<MockEventEngine>();
+    event_engine_ = mock_ee_;
+    auto capture = [this](std::chrono::duration<int64_t, std::nano>,
+                          absl::AnyInvocable<void()> callback) {
+      intptr_t key = next_key_++;
+      timer_callbacks_[key] = std::move(callback);
+      return EventEngine::TaskHandle{key, 0};
+    };
+    ON_CALL(*mock_ee_,
+            RunAfter(::testing::_, ::testing::A<absl::AnyInvocable<void()>>()))
+        .WillByDefault(capture);
+    auto cancel = [this](EventEngine::TaskHandle handle) {
+      auto it = timer_callbacks_.find(handle.keys[0]);
+      if (it == timer_callbacks_.end()) return false;
+      timer_callbacks_.erase(it);
+      return true;
+    };
+    ON_CALL(*mock_ee_, Cancel(::testing::_)).WillByDefault(cancel);
+    lb_policy_ = MakeLbPolicy("outlier_detection_experimental");
+  }
+
+  void RunTimerCallback() {
+    ASSERT_EQ(timer_callbacks_.size(), 1UL);
+    auto it = timer_callbacks_.begin();
+    ASSERT_NE(it->second, nullptr);
+    std::move(it->second)();
+    timer_callbacks_.erase(it);
+  }
+
+  // Sends an update with the given addresses and config, connects all of
+  // the subchannels, and returns the round_robin picker that uses all of
+  // them.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, std::move(config)),
+                          lb_policy_.get()),
+              absl::OkStatus());
+    ExpectConnectingUpdate();
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << "Address: " << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+      if (i == 0) {
+        picker = WaitForConnected();
+        ExpectRoundRobinPicks(picker.get(), {addresses[0]});
+      } else {
+        picker = WaitForRoundRobinListChange(
+            absl::MakeSpan(addresses).subspan(0, i),
+            absl::MakeSpan(addresses).subspan(0, i + 1));
+      }
+    }
+    return picker;
+  }
+
+  // Declared before lb_policy_, so that they outlive it: shutting down the
+  // policy cancels its timer.
+  std::shared_ptr<MockEventEngine> mock_ee_;
+  std::map<intptr_t, absl::AnyInvocable<void()>> timer_callbacks_;
+  intptr_t next_key_ = 1;
+  TestTimeCache time_cache_;
   OrphanablePtr<LoadBalancingPolicy> lb_policy_;
 };
 
@@ -158,6 +273,45 @@ TEST_F(OutlierDetectionTest, Basic) {
   }
 }
 
+TEST_F(OutlierDetectionTest, LatencyEjection) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const absl::string_view kSlowAddress = kAddresses[2];
+  constexpr Duration kInterval = Duration::Seconds(10);
+  auto config = ConfigBuilder()
+                    .SetInterval(kInterval)
+                    .SetMaxEjectionPercent(100)
+                    .SetLatencyThreshold(200)
+                    .SetLatencyEnforcementPercentage(100)
+                    .SetLatencyMinimumHosts(3)
+                    .SetLatencyRequestVolume(10)
+                    .Build();
+  auto picker = ExpectStartup(kAddresses, std::move(config));
+  ASSERT_NE(picker, nullptr);
+  // Calls to one address take much longer than calls to the others.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      subchannel_call_trackers;
+  auto picks = GetCompletePicks(picker.get(), 10 * kAddresses.size(), {},
+                                &subchannel_call_trackers);
+  ASSERT_TRUE(picks.has_value());
+  for (size_t i = 0; i < picks->size(); ++i) {
+    auto& tracker = subchannel_call_trackers[i];
+    ASSERT_NE(tracker, nullptr);
+    tracker->Start();
+    if ((*picks)[i] == kSlowAddress) {
+      gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+    }
+    FinishCall(tracker.get(), (*picks)[i]);
+  }
+  // When the interval ends, the slow address is ejected.
+  time_cache_.IncrementBy(kInterval);
+  RunTimerCallback();
+  picker = WaitForRoundRobinListChange(kAddresses,
+                                       absl::MakeSpan(kAddresses).first(2));
+  EXPECT_NE(picker, nullptr);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -0,0 +1,172 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PeakEwmaTest : public LoadBalancingPolicyTest {
+ protected:
+  PeakEwmaTest() : lb_policy_(MakeLbPolicy("peak_ewma_experimental")) {}
+
+  // Connects all of the addresses and returns a picker that uses all of
+  // them.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    return ExpectRandomPickerStartup(
+        addresses,
+        Json::Array{Json::Object{{"peak_ewma_experimental", Json::Object{}}}},
+        lb_policy_.get());
+  }
+
+  // Picks until the picker returns address and returns the call tracker
+  // for that pick.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+  PickAddress(LoadBalancingPolicy::SubchannelPicker* picker,
+              absl::string_view address) {
+    for (size_t i = 0; i < 100; ++i) {
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker;
+      auto picked = ExpectPickComplete(picker, {}, &tracker);
+      EXPECT_NE(tracker, nullptr);
+      if (picked == address) return tracker;
+    }
+    ADD_FAILURE() << "never picked " << address;
+    return nullptr;
+  }
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+};
+
+TEST_F(PeakEwmaTest, PrefersEndpointWithLowerLatency) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Give the first address a slow call and the second a fast one.
+  auto slow_tracker = PickAddress(picker.get(), kAddresses[0]);
+  ASSERT_NE(slow_tracker, nullptr);
+  slow_tracker->Start();
+  absl::SleepFor(absl::Milliseconds(50));
+  FinishCall(slow_tracker.get(), kAddresses[0]);
+  auto fast_tracker = PickAddress(picker.get(), kAddresses[1]);
+  ASSERT_NE(fast_tracker, nullptr);
+  fast_tracker->Start();
+  FinishCall(fast_tracker.get(), kAddresses[1]);
+  // With two endpoints, every pick compares both of them.
+  auto picks = GetCompletePicks(picker.get(), 20);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_EQ(address, kAddresses[1]);
+  }
+}
+
+TEST_F(PeakEwmaTest, PenalizesEndpointWithFailedCalls) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // The first address fails its call immediately, while the second one
+  // takes a little longer to succeed.
+  auto failed_tracker = PickAddress(picker.get(), kAddresses[0]);
+  ASSERT_NE(failed_tracker, nullptr);
+  failed_tracker->Start();
+  FinishCall(failed_tracker.get(), kAddresses[0],
+             absl::UnavailableError("backend failed"));
+  auto ok_tracker = PickAddress(picker.get(), kAddresses[1]);
+  ASSERT_NE(ok_tracker, nullptr);
+  ok_tracker->Start();
+  absl::SleepFor(absl::Milliseconds(1));
+  FinishCall(ok_tracker.get(), kAddresses[1]);
+  auto picks = GetCompletePicks(picker.get(), 20);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_EQ(address, kAddresses[1]);
+  }
+}
+
+TEST_F(PeakEwmaTest, AvoidsEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Leave a call in flight on the first address, which has no latency data
+  // yet.
+  auto tracker = PickAddress(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  tracker->Start();
+  auto picks = GetCompletePicks(picker.get(), 20);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_EQ(address, kAddresses[1]);
+  }
+  FinishCall(tracker.get(), kAddresses[0]);
+}
+
+TEST_F(PeakEwmaTest, ComparesDistinctEndpoints) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto tracker = PickAddress(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  tracker->Start();
+  // Every pick compares two different endpoints, so the one with a call in
+  // flight always loses. Sampling with replacement would pick it whenever
+  // it was drawn twice.
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  for (const std::string& address : *picks) {
+    EXPECT_NE(address, kAddresses[0]);
+  }
+  FinishCall(tracker.get(), kAddresses[0]);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -17,6 +17,7 @@
 #include <stddef.h>
 
 #include <array>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
@@ -24,7 +25,9 @@
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
+#include <grpc/impl/grpc_types.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
@@ -102,6 +105,45 @@ TEST_F(RoundRobinTest, AddressUpdates) {
                               absl::MakeSpan(kAddresses).last(2));
 }
 
+TEST_F(RoundRobinTest, MaxConcurrentConnects) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_ROUND_ROBIN_MAX_CONCURRENT_CONNECTS, 1);
+  auto update = BuildUpdate(kAddresses);
+  update.args = args;
+  EXPECT_EQ(ApplyUpdate(std::move(update), lb_policy_.get()),
+            absl::OkStatus());
+  ExpectConnectingUpdate();
+  // Returns the subchannels that have requested a connection.
+  auto connecting_subchannels = [&]() {
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : kAddresses) {
+      auto* subchannel = FindSubchannel(address, args);
+      EXPECT_NE(subchannel, nullptr) << "Address: " << address;
+      if (subchannel != nullptr && subchannel->ConnectionRequested()) {
+        subchannels.push_back(subchannel);
+      }
+    }
+    return subchannels;
+  };
+  // Only one subchannel connects at a time. A failed attempt lets the next
+  // one start too.
+  auto subchannels = connecting_subchannels();
+  ASSERT_EQ(subchannels.size(), 1u);
+  subchannels[0]->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  EXPECT_TRUE(connecting_subchannels().empty());
+  subchannels[0]->SetConnectivityState(GRPC_CHANNEL_READY);
+  WaitForConnected();
+  subchannels = connecting_subchannels();
+  ASSERT_EQ(subchannels.size(), 1u);
+  subchannels[0]->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  EXPECT_TRUE(connecting_subchannels().empty());
+  subchannels[0]->SetConnectivityState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                       absl::UnavailableError("failed"));
+  EXPECT_EQ(connecting_subchannels().size(), 1u);
+}
+
 // TODO(roth): Add test cases:
 // - empty address list
 // - subchannels failing connection attempts
@@ -56,6 +56,20 @@ const std::vector<float>& Weights() {
   return *kWeights;
 }
 
+// Returns a list of weights where one in every 100 is 1.0 and the rest are
+// 0.01, which makes unbatched picks skip most backends.
+const std::vector<float>& SkewedWeights() {
+  static const NoDestruct<std::vector<float>> kWeights([] {
+    std::vector<float> weights;
+    weights.reserve(kNumWeightsHigh);
+    for (int i = 0; i < kNumWeightsHigh; ++i) {
+      weights.push_back(i % 100 == 0 ? 1.0 : 0.01);
+    }
+    return weights;
+  }());
+  return *kWeights;
+}
+
 void BM_StaticStrideSchedulerPickNonAtomic(benchmark::State& state) {
   uint32_t sequence = 0;
   const absl::optional<StaticStrideScheduler> scheduler =
@@ -86,6 +100,51 @@ BENCHMARK(BM_StaticStrideSchedulerPickAtomic)
     ->RangeMultiplier(kRangeMultiplier)
     ->Range(kNumWeightsLow, kNumWeightsHigh);
 
+void BM_StaticStrideSchedulerPickSkewed(benchmark::State& state) {
+  std::atomic<uint32_t> sequence{0};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::Make(
+          absl::MakeSpan(SkewedWeights()).subspan(0, state.range(0)),
+          [&] { return sequence.fetch_add(1, std::memory_order_relaxed); });
+  GPR_ASSERT(scheduler.has_value());
+  for (auto s : state) {
+    benchmark::DoNotOptimize(scheduler->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerPickSkewed)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
+void BM_StaticStrideSchedulerBatchedPick(benchmark::State& state) {
+  std::atomic<uint32_t> sequence{0};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::MakeBatched(
+          absl::MakeSpan(Weights()).subspan(0, state.range(0)),
+          [&] { return sequence.fetch_add(1, std::memory_order_relaxed); });
+  GPR_ASSERT(scheduler.has_value());
+  for (auto s : state) {
+    benchmark::DoNotOptimize(scheduler->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerBatchedPick)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
+void BM_StaticStrideSchedulerBatchedPickSkewed(benchmark::State& state) {
+  std::atomic<uint32_t> sequence{0};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::MakeBatched(
+          absl::MakeSpan(SkewedWeights()).subspan(0, state.range(0)),
+          [&] { return sequence.fetch_add(1, std::memory_order_relaxed); });
+  GPR_ASSERT(scheduler.has_value());
+  for (auto s : state) {
+    benchmark::DoNotOptimize(scheduler->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerBatchedPickSkewed)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
 void BM_StaticStrideSchedulerMake(benchmark::State& state) {
   uint32_t sequence = 0;
   for (auto s : state) {
@@ -100,6 +159,20 @@ BENCHMARK(BM_StaticStrideSchedulerMake)
     ->RangeMultiplier(kRangeMultiplier)
     ->Range(kNumWeightsLow, kNumWeightsHigh);
 
+void BM_StaticStrideSchedulerMakeBatched(benchmark::State& state) {
+  uint32_t sequence = 0;
+  for (auto s : state) {
+    const absl::optional<StaticStrideScheduler> scheduler =
+        StaticStrideScheduler::MakeBatched(
+            absl::MakeSpan(Weights()).subspan(0, state.range(0)),
+            [&] { return sequence++; });
+    GPR_ASSERT(scheduler.has_value());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerMakeBatched)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -187,6 +187,62 @@ TEST(StaticStrideSchedulerTest, LargestIsPickedEveryGeneration) {
   EXPECT_EQ(largest_weight_pick_count, kMaxWeight);
 }
 
+TEST(StaticStrideSchedulerTest, BatchedPicksAreWeighted) {
+  uint32_t sequence = 0;
+  const std::vector<float> weights = {1, 2, 3};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::MakeBatched(absl::MakeSpan(weights),
+                                         [&] { return sequence++; });
+  ASSERT_TRUE(scheduler.has_value());
+
+  // The pick table is built with the max weight scaled to 1024, so one cycle
+  // is 341 + 683 + 1024 picks.
+  std::vector<int> picks(weights.size());
+  for (int i = 0; i < 2048; ++i) {
+    ++picks[scheduler->Pick()];
+  }
+  EXPECT_THAT(picks, ElementsAre(341, 683, 1024));
+}
+
+TEST(StaticStrideSchedulerTest, BatchedAllWeightsEqualIsRoundRobin) {
+  uint32_t sequence = 0;
+  const std::vector<float> weights = {300, 300, 0};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::MakeBatched(absl::MakeSpan(weights),
+                                         [&] { return sequence++; });
+  ASSERT_TRUE(scheduler.has_value());
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(scheduler->Pick(), static_cast<size_t>(i % 3));
+  }
+}
+
+TEST(StaticStrideSchedulerTest, BatchedWithManyWeightsPicksLikeUnbatched) {
+  uint32_t sequence = 0;
+  std::vector<float> weights;
+  for (int i = 0; i < 2000; ++i) weights.push_back(1 + i % 7);
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::Make(absl::MakeSpan(weights),
+                                  [&] { return sequence++; });
+  ASSERT_TRUE(scheduler.has_value());
+  const absl::optional<StaticStrideScheduler> batched =
+      StaticStrideScheduler::MakeBatched(absl::MakeSpan(weights),
+                                         [&] { return sequence++; });
+  ASSERT_TRUE(batched.has_value());
+
+  // Too many weights for the pick table, so both use the same algorithm.
+  const int n = 100;
+  std::vector<size_t> picks;
+  picks.reserve(n);
+  for (int i = 0; i < n; ++i) {
+    picks.push_back(scheduler->Pick());
+  }
+  sequence = 0;
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(batched->Pick(), picks[i]);
+  }
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -60,11 +60,14 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -527,6 +530,30 @@ TEST_F(EventPollerTest, TestEventPollerHandleChange) {
   close(sv[1]);
 }
 
+// Test that a handle which is orphaned before the poller gets to run another
+// poll cycle never reaches the epoll set when registrations are deferred.
+TEST_F(EventPollerTest, TestOrphanBeforeDeferredRegistration) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "epoll1" ||
+      !grpc_core::IsEventEngineBatchedEpollRegistrationEnabled()) {
+    GTEST_SKIP() << "this test is only valid with deferred epoll registration";
+  }
+  int sv[2];
+  EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+  auto before = grpc_core::global_stats().Collect();
+  EventHandle* em_fd = g_event_poller->CreateHandle(
+      sv[0], "TestOrphanBeforeDeferredRegistration", false);
+  EXPECT_NE(em_fd, nullptr);
+  int release_fd = -1;
+  em_fd->OrphanHandle(nullptr, &release_fd, "");
+  EXPECT_EQ(release_fd, sv[0]);
+  auto diff = grpc_core::global_stats().Collect()->Diff(*before);
+  // Both the EPOLL_CTL_ADD and the EPOLL_CTL_DEL were skipped.
+  EXPECT_EQ(diff->syscall_epoll_ctl, 0);
+  EXPECT_EQ(diff->syscall_epoll_ctl_elided, 2);
+  close(sv[0]);
+  close(sv[1]);
+}
+
 std::atomic<int> kTotalActiveWakeupFdHandles{0};
 
 // A helper class representing one file descriptor. Its implemented using
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -153,6 +154,70 @@ TEST(LockFreeEventTest, MultiThreadedTest) {
   event.DestroyEvent();
 }
 
+TEST(LockFreeEventTest, ShutdownRacesWithSetReady) {
+  static constexpr int kNumIterations = 100;
+  static constexpr int kNumSetReadyThreads = 4;
+  LockfreeEvent event(g_scheduler);
+  for (int i = 0; i < kNumIterations; i++) {
+    event.InitEvent();
+    grpc_core::Mutex mu;
+    grpc_core::CondVar cv;
+    int num_runs = 0;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    threads.reserve(kNumSetReadyThreads);
+    for (int j = 0; j < kNumSetReadyThreads; j++) {
+      threads.emplace_back([&event, &done]() {
+        while (!done.load(std::memory_order_relaxed)) {
+          event.SetReady();
+        }
+      });
+    }
+    // The closure must run exactly once, either because the event became
+    // ready or because it was shut down.
+    event.NotifyOn(PosixEngineClosure::TestOnlyToClosure(
+        [&mu, &cv, &num_runs](absl::Status status) {
+          grpc_core::MutexLock lock(&mu);
+          EXPECT_TRUE(status.ok() ||
+                      status == absl::CancelledError("Shutdown"));
+          ++num_runs;
+          cv.Signal();
+        }));
+    EXPECT_TRUE(event.SetShutdown(absl::CancelledError("Shutdown")));
+    EXPECT_FALSE(event.SetShutdown(absl::CancelledError("Shutdown again")));
+    EXPECT_TRUE(event.IsShutdown());
+    {
+      grpc_core::MutexLock lock(&mu);
+      while (num_runs == 0) {
+        EXPECT_FALSE(cv.WaitWithTimeout(&mu, absl::Seconds(10)));
+      }
+    }
+    done.store(true, std::memory_order_relaxed);
+    for (auto& t : threads) {
+      t.join();
+    }
+    {
+      grpc_core::MutexLock lock(&mu);
+      EXPECT_EQ(num_runs, 1);
+    }
+    // Any NotifyOn after shutdown gets the first shutdown error.
+    event.NotifyOn(PosixEngineClosure::TestOnlyToClosure(
+        [&mu, &cv, &num_runs](absl::Status status) {
+          grpc_core::MutexLock lock(&mu);
+          EXPECT_EQ(status, absl::CancelledError("Shutdown"));
+          ++num_runs;
+          cv.Signal();
+        }));
+    {
+      grpc_core::MutexLock lock(&mu);
+      while (num_runs == 1) {
+        EXPECT_FALSE(cv.WaitWithTimeout(&mu, absl::Seconds(10)));
+      }
+    }
+    event.DestroyEvent();
+  }
+}
+
 namespace {
 
 // A trivial callback sceduler which inherits from the Scheduler interface but
@@ -187,6 +252,79 @@ void BM_LockFreeEvent(benchmark::State& state) {
 }
 BENCHMARK(BM_LockFreeEvent)->ThreadRange(1, 64);
 
+// Shared by all threads of the contended benchmarks below.
+BechmarkCallbackScheduler* g_bm_scheduler;
+LockfreeEvent* g_bm_event;
+std::atomic<bool> g_bm_closure_pending;
+
+// A benchmark in which thread 0 is the single waiter, repeatedly registering
+// a NotifyOn callback, while all other threads concurrently call SetReady on
+// the same event, as a poller thread would for a connection that is hot for
+// reads. This measures the cost of NotifyOn and SetReady under contention.
+void BM_LockFreeEventContendedNotifyOnSetReady(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_bm_scheduler = new BechmarkCallbackScheduler();
+    g_bm_event = new LockfreeEvent(g_bm_scheduler);
+    g_bm_event->InitEvent();
+    g_bm_closure_pending.store(false, std::memory_order_relaxed);
+  }
+  PosixEngineClosure* notify_on_closure =
+      PosixEngineClosure::ToPermanentClosure([](absl::Status /*status*/) {
+        g_bm_closure_pending.store(false, std::memory_order_release);
+      });
+  for (auto s : state) {
+    if (state.thread_index() == 0) {
+      // Only one NotifyOn may be outstanding at a time.
+      if (!g_bm_closure_pending.load(std::memory_order_acquire)) {
+        g_bm_closure_pending.store(true, std::memory_order_relaxed);
+        g_bm_event->NotifyOn(notify_on_closure);
+      }
+    }
+    g_bm_event->SetReady();
+  }
+  if (state.thread_index() == 0) {
+    g_bm_event->SetShutdown(absl::CancelledError("Shutting down"));
+    g_bm_event->DestroyEvent();
+    delete g_bm_event;
+    delete g_bm_scheduler;
+  }
+  delete notify_on_closure;
+}
+BENCHMARK(BM_LockFreeEventContendedNotifyOnSetReady)->ThreadRange(2, 64);
+
+// A benchmark in which thread 0 repeatedly registers a NotifyOn callback and
+// shuts the event down while all other threads call SetReady on it. This
+// measures how SetShutdown behaves on an event that is hot for reads.
+void BM_LockFreeEventShutdownWhileReady(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_bm_scheduler = new BechmarkCallbackScheduler();
+    g_bm_event = new LockfreeEvent(g_bm_scheduler);
+    g_bm_event->InitEvent();
+  }
+  PosixEngineClosure* notify_on_closure =
+      PosixEngineClosure::ToPermanentClosure([](absl::Status /*status*/) {});
+  for (auto s : state) {
+    if (state.thread_index() == 0) {
+      g_bm_event->NotifyOn(notify_on_closure);
+      g_bm_event->SetShutdown(absl::CancelledError("Shutting down"));
+      // Events may be reused while other threads still call SetReady on them,
+      // as happens when an fd is returned to a freelist.
+      g_bm_event->DestroyEvent();
+      g_bm_event->InitEvent();
+    } else {
+      g_bm_event->SetReady();
+    }
+  }
+  if (state.thread_index() == 0) {
+    g_bm_event->SetShutdown(absl::CancelledError("Shutting down"));
+    g_bm_event->DestroyEvent();
+    delete g_bm_event;
+    delete g_bm_scheduler;
+  }
+  delete notify_on_closure;
+}
+BENCHMARK(BM_LockFreeEventShutdownWhileReady)->ThreadRange(1, 64);
+
 }  // namespace
 
 }  // namespace experimental
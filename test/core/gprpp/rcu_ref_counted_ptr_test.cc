@@ -0,0 +1,95 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/rcu_ref_counted_ptr.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class Foo : public RefCounted<Foo> {
+ public:
+  explicit Foo(int value) : value_(value) {}
+  ~Foo() override { value_ = -1; }
+
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+TEST(RcuRefCountedPtrTest, StartsEmpty) {
+  ExecCtx exec_ctx;
+  RcuRefCountedPtr<Foo> ptr;
+  EXPECT_EQ(ptr.Get(), nullptr);
+}
+
+TEST(RcuRefCountedPtrTest, SetReturnsPreviousValue) {
+  ExecCtx exec_ctx;
+  RcuRefCountedPtr<Foo> ptr(MakeRefCounted<Foo>(1));
+  EXPECT_EQ(ptr.Get()->value(), 1);
+  RefCountedPtr<Foo> old = ptr.Set(MakeRefCounted<Foo>(2));
+  EXPECT_EQ(old->value(), 1);
+  EXPECT_EQ(ptr.Get()->value(), 2);
+  EXPECT_EQ(ptr.Set(nullptr)->value(), 2);
+  EXPECT_EQ(ptr.Get(), nullptr);
+}
+
+TEST(RcuRefCountedPtrTest, ReadersNeverSeeDestroyedValues) {
+  RcuRefCountedPtr<Foo> ptr(MakeRefCounted<Foo>(0));
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&ptr, &done]() {
+      ExecCtx exec_ctx;
+      int last = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        RefCountedPtr<Foo> foo = ptr.Get();
+        ASSERT_NE(foo, nullptr);
+        // Values are only ever replaced by larger ones.
+        ASSERT_GE(foo->value(), last);
+        last = foo->value();
+      }
+    });
+  }
+  {
+    ExecCtx exec_ctx;
+    for (int i = 1; i <= 10000; ++i) {
+      // The old value is released here, while readers keep going.
+      ptr.Set(MakeRefCounted<Foo>(i));
+    }
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& reader : readers) reader.join();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -273,6 +273,121 @@ TEST_F(PipeTest, CanCloseSend) {
       MakeScopedArena(1024, &memory_allocator_));
 }
 
+TEST_F(PipeTest, CloseSendFailsPushedValue) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<Pipe<int>>();
+        auto* push = GetContext<Arena>()->ManagedNew<PipeSender<int>::PushType>(
+            pipe->sender.Push(42));
+        return Seq(
+            // A plain Close() right behind a pushed value fails the push,
+            // even though the value is still delivered.
+            [pipe, push]() mutable {
+              EXPECT_TRUE((*push)().pending());
+              pipe->sender.Close();
+              Poll<bool> acked = (*push)();
+              EXPECT_TRUE(acked.ready());
+              EXPECT_FALSE(acked.value());
+              return absl::OkStatus();
+            },
+            [pipe](absl::Status) { return pipe->receiver.Next(); },
+            [pipe, push](NextResult<int> result) {
+              EXPECT_TRUE(result.has_value());
+              EXPECT_EQ(*result, 42);
+              // Taking the value does not ack the push after the fact.
+              Poll<bool> acked = (*push)();
+              EXPECT_TRUE(acked.ready());
+              EXPECT_FALSE(acked.value());
+              return pipe->receiver.Next();
+            },
+            [](NextResult<int> result) {
+              EXPECT_FALSE(result.has_value());
+              EXPECT_FALSE(result.cancelled());
+              return absl::OkStatus();
+            });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
+TEST_F(PipeTest, CanCloseSendBehindPushedValue) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<Pipe<int>>();
+        auto* push = GetContext<Arena>()->ManagedNew<PipeSender<int>::PushType>(
+            pipe->sender.Push(42));
+        return Seq(
+            // The value is accepted by the pipe straight away, after which
+            // the push only waits for the receiver to ack it. Close the
+            // sender right behind it.
+            [pipe, push]() mutable {
+              EXPECT_TRUE((*push)().pending());
+              EXPECT_TRUE(push->pushed());
+              pipe->sender.CloseBehindPush();
+              return absl::OkStatus();
+            },
+            // The receiver still gets the value...
+            [pipe](absl::Status) { return pipe->receiver.Next(); },
+            // ... which acks the push...
+            [pipe, push](NextResult<int> result) {
+              EXPECT_TRUE(result.has_value());
+              EXPECT_EQ(*result, 42);
+              Poll<bool> acked = (*push)();
+              EXPECT_TRUE(acked.ready());
+              EXPECT_TRUE(acked.value());
+              return pipe->receiver.Next();
+            },
+            // ... followed by end-of-stream.
+            [](NextResult<int> result) {
+              EXPECT_FALSE(result.has_value());
+              EXPECT_FALSE(result.cancelled());
+              return absl::OkStatus();
+            });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
+TEST_F(PipeTest, PushBehindCloseFailsIfNeverReceived) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        Pipe<int> pipe;
+        auto sender = std::make_shared<PipeSender<int>>(std::move(pipe.sender));
+        auto receiver = std::make_shared<std::unique_ptr<PipeReceiver<int>>>(
+            std::make_unique<PipeReceiver<int>>(std::move(pipe.receiver)));
+        auto push =
+            std::make_shared<PipeSender<int>::PushType>(sender->Push(42));
+        return Seq(
+            // Close the sender behind the pushed value: until the receiver
+            // takes it, the push is not acked.
+            [sender, push]() mutable {
+              EXPECT_TRUE((*push)().pending());
+              sender->CloseBehindPush();
+              EXPECT_TRUE((*push)().pending());
+              return absl::OkStatus();
+            },
+            // Dropping the receiver without reading fails the push.
+            [receiver, push](absl::Status) {
+              receiver->reset();
+              Poll<bool> acked = (*push)();
+              EXPECT_TRUE(acked.ready());
+              EXPECT_FALSE(acked.value());
+              return absl::OkStatus();
+            });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
 TEST_F(PipeTest, CanCloseSendWithInterceptor) {
   StrictMock<MockFunction<void(absl::Status)>> on_done;
   EXPECT_CALL(on_done, Call(absl::OkStatus()));
@@ -114,6 +114,77 @@ TEST_F(ArenaTest, ManagedNew) {
   arena->Destroy();
 }
 
+TEST_F(ArenaTest, StoragePoolReusesBlocks) {
+  ExecCtx exec_ctx;
+  ArenaStoragePool pool(&memory_allocator_, /*max_cached_blocks=*/1);
+  auto first = Arena::CreateWithAlloc(1024, 64, &memory_allocator_, &pool);
+  auto second = Arena::CreateWithAlloc(1024, 64, &memory_allocator_, &pool);
+  Arena* first_arena = first.first;
+  first.first->Destroy();
+  // The pool only holds one block: this one goes back to the allocator.
+  second.first->Destroy();
+  // Same or smaller sizes reuse the cached block...
+  auto third = Arena::CreateWithAlloc(512, 64, &memory_allocator_, &pool);
+  EXPECT_EQ(third.first, first_arena);
+  // ... and the whole original initial zone is still usable.
+  for (int i = 0; i < 10; i++) third.first->Alloc(64);
+  EXPECT_EQ(third.first->TotalUsedBytes(), 11u * 64);
+  third.first->Destroy();
+  // Larger ones can't use it (it's dropped), but still get an arena.
+  auto fourth = Arena::CreateWithAlloc(4096, 64, &memory_allocator_, &pool);
+  fourth.first->Alloc(2048);
+  fourth.first->Destroy();
+}
+
+// Counts the bytes reserved through it.
+class CountingAllocatorImpl
+    : public grpc_event_engine::experimental::internal::MemoryAllocatorImpl {
+ public:
+  size_t Reserve(grpc_event_engine::experimental::MemoryRequest request)
+      override {
+    reserved_ += request.max();
+    return request.max();
+  }
+  void Release(size_t n) override {
+    ASSERT_GE(reserved_, n);
+    reserved_ -= n;
+  }
+  void Shutdown() override {}
+
+  size_t reserved() const { return reserved_; }
+
+ private:
+  size_t reserved_ = 0;
+};
+
+TEST_F(ArenaTest, StoragePoolAccountsForCachedBlocks) {
+  ExecCtx exec_ctx;
+  auto impl = std::make_shared<CountingAllocatorImpl>();
+  MemoryAllocator pool_allocator(impl);
+  {
+    ArenaStoragePool pool(&pool_allocator, /*max_cached_blocks=*/2);
+    auto first = Arena::CreateWithAlloc(1024, 64, &memory_allocator_, &pool);
+    auto second = Arena::CreateWithAlloc(1024, 64, &memory_allocator_, &pool);
+    EXPECT_EQ(impl->reserved(), 0u);
+    first.first->Destroy();
+    const size_t block_size = impl->reserved();
+    EXPECT_GT(block_size, 1024u);
+    second.first->Destroy();
+    EXPECT_EQ(impl->reserved(), 2 * block_size);
+    // Reusing a block hands its reservation back.
+    auto third = Arena::CreateWithAlloc(1024, 64, &memory_allocator_, &pool);
+    EXPECT_EQ(impl->reserved(), block_size);
+    third.first->Destroy();
+    EXPECT_EQ(impl->reserved(), 2 * block_size);
+    // So does dropping a block that is too small to be reused.
+    auto fourth = Arena::CreateWithAlloc(4096, 64, &memory_allocator_, &pool);
+    EXPECT_EQ(impl->reserved(), block_size);
+    fourth.first->Destroy();
+  }
+  // Destroying the pool releases everything that is still cached.
+  EXPECT_EQ(impl->reserved(), 0u);
+}
+
 TEST_F(ArenaTest, ConcurrentAlloc) {
   concurrent_test_args args;
   gpr_event_init(&args.ev_start);
@@ -20,6 +20,9 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
 
@@ -170,6 +173,60 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_event events[8];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[5];
+  void* tags[GPR_ARRAY_SIZE(completions)];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+
+  LOG_TEST("test_next_batch");
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(completions); j++) {
+      tags[j] = create_test_tag();
+      ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], absl::OkStatus(), do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    // The first batch is capped by max_events, the second one returns
+    // whatever is left.
+    size_t seen = 0;
+    for (int max_events : {3, 8}) {
+      int n = grpc_completion_queue_next_batch(
+          cc, events, max_events, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr);
+      ASSERT_GE(n, 1);
+      ASSERT_LE(n, max_events);
+      for (int k = 0; k < n; k++) {
+        ASSERT_EQ(events[k].type, GRPC_OP_COMPLETE);
+        ASSERT_TRUE(events[k].success);
+        ASSERT_NE(std::find(std::begin(tags), std::end(tags), events[k].tag),
+                  std::end(tags));
+      }
+      seen += n;
+    }
+    ASSERT_EQ(seen, GPR_ARRAY_SIZE(completions));
+
+    grpc_completion_queue_shutdown(cc);
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_future(GPR_CLOCK_REALTIME), nullptr),
+              1);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
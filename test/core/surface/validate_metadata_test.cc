@@ -0,0 +1,106 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/lib/surface/validate_metadata.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/iomgr/error.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+bool IsLegalKeyByte(uint8_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' ||
+         c == '_' || c == '.';
+}
+
+bool IsLegalNonBinValueByte(uint8_t c) { return c >= 32 && c <= 126; }
+
+// Validation screens eight bytes at a time and falls back to a per-byte
+// table, so place every byte value at every offset of strings long enough to
+// cover several whole words plus a tail, and check both the verdict and the
+// reported offset.
+template <typename Validate, typename IsLegalByte>
+void CheckEveryByteAtEveryOffset(const std::string& legal_filler,
+                                 Validate validate, IsLegalByte is_legal) {
+  for (size_t len = 1; len <= 19; len++) {
+    for (size_t pos = 0; pos < len; pos++) {
+      for (int c = 0; c < 256; c++) {
+        std::string s(len, ' ');
+        for (size_t i = 0; i < len; i++) {
+          s[i] = legal_filler[i % legal_filler.size()];
+        }
+        s[pos] = static_cast<char>(c);
+        grpc_slice slice = grpc_slice_from_copied_buffer(s.data(), s.size());
+        grpc_error_handle error = validate(slice);
+        const bool expect_legal =
+            is_legal(static_cast<uint8_t>(c)) && !(pos == 0 && c == ':');
+        EXPECT_EQ(error.ok(), expect_legal)
+            << "len=" << len << " pos=" << pos << " byte=" << c;
+        intptr_t offset;
+        if (!expect_legal &&
+            grpc_error_get_int(error, StatusIntProperty::kOffset, &offset)) {
+          EXPECT_EQ(offset, static_cast<intptr_t>(pos))
+              << "len=" << len << " byte=" << c;
+        }
+        grpc_slice_unref(slice);
+      }
+    }
+  }
+}
+
+TEST(ValidateMetadataTest, HeaderKeys) {
+  CheckEveryByteAtEveryOffset("user-agent_0.9",
+                              grpc_validate_header_key_is_legal,
+                              IsLegalKeyByte);
+}
+
+TEST(ValidateMetadataTest, NonBinHeaderValues) {
+  CheckEveryByteAtEveryOffset("grpc-c++/1.54 (linux; chttp2)",
+                              grpc_validate_header_nonbin_value_is_legal,
+                              IsLegalNonBinValueByte);
+}
+
+TEST(ValidateMetadataTest, EmptyKeyIsIllegal) {
+  EXPECT_FALSE(grpc_validate_header_key_is_legal(grpc_empty_slice()).ok());
+  EXPECT_TRUE(
+      grpc_validate_header_nonbin_value_is_legal(grpc_empty_slice()).ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -21,9 +21,12 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
@@ -35,6 +38,8 @@
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/transport/transport.h"
@@ -63,6 +68,21 @@ void TestExecuteFlushesListVerifier(void* arg, Timestamps* ts,
 
 void discard_write(grpc_slice /*slice*/) {}
 
+class FakeCallTracer : public CallTracer {
+ public:
+  CallAttemptTracer* StartNewAttempt(bool /*is_transparent_retry*/) override {
+    return nullptr;
+  }
+  void RecordAnnotation(absl::string_view annotation) override {
+    annotations_.emplace_back(annotation);
+  }
+
+  const std::vector<std::string>& annotations() const { return annotations_; }
+
+ private:
+  std::vector<std::string> annotations_;
+};
+
 class ContextListTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -167,6 +187,75 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+/// Tests that the latency breakdown of an acked write is reported to the
+/// stream's WriteLatencyTracer and to the stats histograms, and that nothing
+/// reaches the CallTracer once the tracer is detached.
+TEST_F(ContextListTest, ReportsWriteLatencyBreakdown) {
+  ExecCtx exec_ctx;
+  grpc_stream_refcount ref;
+  GRPC_STREAM_REF_INIT(&ref, 1, nullptr, nullptr, "phony ref");
+  grpc_endpoint* mock_endpoint = grpc_mock_endpoint_create(discard_write);
+  auto args = CoreConfiguration::Get()
+                  .channel_args_preconditioning()
+                  .PreconditionChannelArgs(nullptr);
+  grpc_transport* t = grpc_create_chttp2_transport(args, mock_endpoint, true);
+  grpc_chttp2_stream* s = static_cast<grpc_chttp2_stream*>(
+      gpr_malloc(grpc_transport_stream_size(t)));
+  grpc_transport_init_stream(reinterpret_cast<grpc_transport*>(t),
+                             reinterpret_cast<grpc_stream*>(s), &ref, nullptr,
+                             nullptr);
+  gpr_atm verifier_called;
+  gpr_atm_rel_store(&verifier_called, gpr_atm{0});
+  s->context = &verifier_called;
+  s->byte_counter = kByteOffset;
+  FakeCallTracer call_tracer;
+  s->write_latency_tracer = MakeRefCounted<WriteLatencyTracer>(&call_tracer);
+  auto make_timestamps = []() {
+    Timestamps ts;
+    ts.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
+    ts.scheduled_time.time = gpr_time_add(
+        ts.sendmsg_time.time, gpr_time_from_micros(1000, GPR_TIMESPAN));
+    ts.sent_time.time = gpr_time_add(ts.scheduled_time.time,
+                                     gpr_time_from_micros(2000, GPR_TIMESPAN));
+    ts.acked_time.time = gpr_time_add(
+        ts.sent_time.time, gpr_time_from_micros(7000, GPR_TIMESPAN));
+    return ts;
+  };
+  auto before = global_stats().Collect();
+  ContextList* list = nullptr;
+  ContextList::Append(&list, s);
+  Timestamps ts = make_timestamps();
+  ContextList::Execute(list, &ts, absl::OkStatus());
+  auto after = global_stats().Collect();
+  EXPECT_EQ(gpr_atm_acq_load(&verifier_called), 1);
+  ASSERT_EQ(call_tracer.annotations().size(), 1);
+  EXPECT_TRUE(absl::StrContains(call_tracer.annotations()[0],
+                                "kernel_us=1000 scheduler_us=2000 ack_us=7000"))
+      << call_tracer.annotations()[0];
+  for (auto histogram : {GlobalStats::Histogram::kHttp2WriteQueuedUs,
+                         GlobalStats::Histogram::kTcpWriteKernelUs,
+                         GlobalStats::Histogram::kTcpWriteSchedulerUs,
+                         GlobalStats::Histogram::kTcpWriteAckUs}) {
+    EXPECT_EQ(after->histogram(histogram).Count() -
+                  before->histogram(histogram).Count(),
+              1);
+  }
+  // Once detached, acked writes still update the histograms but no longer
+  // reach the CallTracer.
+  s->write_latency_tracer->Detach();
+  list = nullptr;
+  ContextList::Append(&list, s);
+  ts = make_timestamps();
+  ContextList::Execute(list, &ts, absl::OkStatus());
+  EXPECT_EQ(call_tracer.annotations().size(), 1);
+  grpc_transport_destroy_stream(reinterpret_cast<grpc_transport*>(t),
+                                reinterpret_cast<grpc_stream*>(s), nullptr);
+  exec_ctx.Flush();
+  gpr_free(s);
+  grpc_transport_destroy(t);
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -41,6 +41,8 @@
 
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/time.h"
@@ -57,19 +59,29 @@
 #include "src/core/lib/resource_quota/api.h"
 #include "test/core/util/port.h"
 #include "test/core/util/test_config.h"
+#include "test/core/util/tls_utils.h"
 
 namespace grpc_core {
 namespace test {
 namespace {
 
+constexpr char kServerCertPath[] = "src/core/tsi/test_creds/server1.pem";
+constexpr char kServerKeyPath[] = "src/core/tsi/test_creds/server1.key";
+
 // A gRPC server, running in its own thread.
 class ServerThread {
  public:
-  explicit ServerThread(const char* address) : address_(address) {}
+  // If \a use_tls is true, the server's handshakes wait for the client to
+  // start a TLS handshake, so they last until the handshake timeout.
+  explicit ServerThread(const char* address, int max_concurrent_handshakes = 0,
+                        bool use_tls = false)
+      : address_(address),
+        max_concurrent_handshakes_(max_concurrent_handshakes),
+        use_tls_(use_tls) {}
 
   void Start() {
     // Start server with 1-second handshake timeout.
-    grpc_arg a[2];
+    grpc_arg a[3];
     a[0].type = GRPC_ARG_INTEGER;
     a[0].key = const_cast<char*>(GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS);
     a[0].value.integer = 1000;
@@ -77,10 +89,22 @@ class ServerThread {
     a[1].type = GRPC_ARG_POINTER;
     a[1].value.pointer.p = grpc_resource_quota_create("test");
     a[1].value.pointer.vtable = grpc_resource_quota_arg_vtable();
-    grpc_channel_args args = {2, a};
+    a[2].type = GRPC_ARG_INTEGER;
+    a[2].key = const_cast<char*>(GRPC_ARG_SERVER_MAX_CONCURRENT_HANDSHAKES);
+    a[2].value.integer = max_concurrent_handshakes_;
+    grpc_channel_args args = {3, a};
     server_ = grpc_server_create(&args, nullptr);
-    grpc_server_credentials* server_creds =
-        grpc_insecure_server_credentials_create();
+    grpc_server_credentials* server_creds;
+    if (use_tls_) {
+      std::string cert = testing::GetFileContents(kServerCertPath);
+      std::string key = testing::GetFileContents(kServerKeyPath);
+      grpc_ssl_pem_key_cert_pair pem_key_cert_pair = {key.c_str(),
+                                                      cert.c_str()};
+      server_creds = grpc_ssl_server_credentials_create(
+          nullptr, &pem_key_cert_pair, 1, 0, nullptr);
+    } else {
+      server_creds = grpc_insecure_server_credentials_create();
+    }
     ASSERT_TRUE(grpc_server_add_http2_port(server_, address_, server_creds));
     grpc_server_credentials_release(server_creds);
     cq_ = grpc_completion_queue_create_for_next(nullptr);
@@ -115,6 +139,8 @@ class ServerThread {
   }
 
   const char* address_;  // Do not own.
+  const int max_concurrent_handshakes_;
+  const bool use_tls_;
   grpc_server* server_ = nullptr;
   grpc_completion_queue* cq_ = nullptr;
   std::unique_ptr<std::thread> thread_;
@@ -271,6 +297,41 @@ TEST(SettingsTimeout, Basic) {
   // Clean up.
 }
 
+// With a limit of one concurrent handshake, the handshakes of the other
+// connections are queued behind a TLS handshake that the client never starts.
+// The handshake deadline of every connection starts at accept, so the queued
+// connections are dropped together with the first one rather than one
+// handshake timeout after another.
+TEST(SettingsTimeout, QueuedHandshakes) {
+  const int server_port = grpc_pick_unused_port_or_die();
+  std::string server_address_string = absl::StrCat("localhost:", server_port);
+  gpr_log(GPR_INFO, "starting server on %s", server_address_string.c_str());
+  ServerThread server_thread(server_address_string.c_str(),
+                             /*max_concurrent_handshakes=*/1,
+                             /*use_tls=*/true);
+  server_thread.Start();
+  auto before = global_stats().Collect();
+  const Timestamp start = Timestamp::Now();
+  std::vector<std::unique_ptr<Client>> clients;
+  for (int i = 0; i < 3; ++i) {
+    gpr_log(GPR_INFO, "starting client %d connect", i);
+    clients.push_back(std::make_unique<Client>(server_address_string.c_str()));
+    clients.back()->Connect();
+  }
+  for (auto& client : clients) {
+    EXPECT_TRUE(client->ReadUntilError());
+    client->Shutdown();
+  }
+  // Queued handshakes would each add a 1-second handshake timeout if their
+  // deadline only started once they were dequeued.
+  EXPECT_LT(Timestamp::Now() - start, Duration::Milliseconds(2500));
+  auto after = global_stats().Collect();
+  EXPECT_EQ(
+      after->server_handshakes_queued - before->server_handshakes_queued, 2);
+  gpr_log(GPR_INFO, "shutting down server");
+  server_thread.Shutdown();
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace grpc_core
@@ -0,0 +1,176 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/impl/completion_queue_tag.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc {
+namespace {
+
+// A tag that the C++ layer swallows, like the ones the library uses for
+// server shutdown notifications.
+class InternalTag : public internal::CompletionQueueTag {
+ public:
+  bool FinalizeResult(void** /*tag*/, bool* /*status*/) override {
+    finalized_ = true;
+    return false;
+  }
+
+  bool finalized() const { return finalized_; }
+
+ private:
+  bool finalized_ = false;
+};
+
+void DoNothing(void* /*arg*/, grpc_cq_completion* /*storage*/) {}
+
+// Posts \a tag directly to the core completion queue underneath \a cq.
+void PostInternalTag(CompletionQueue* cq, InternalTag* tag,
+                     grpc_cq_completion* storage) {
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_TRUE(grpc_cq_begin_op(cq->cq(), tag));
+  grpc_cq_end_op(cq->cq(), tag, absl::OkStatus(), DoNothing, nullptr,
+                 storage);
+}
+
+void* Tag(intptr_t i) { return reinterpret_cast<void*>(i); }
+
+TEST(CompletionQueueTest, NextBatchReturnsQueuedEvents) {
+  CompletionQueue cq;
+  Alarm alarms[3];
+  for (int i = 0; i < 3; ++i) {
+    alarms[i].Set(&cq, gpr_now(GPR_CLOCK_MONOTONIC), Tag(i + 1));
+  }
+  void* tags[8];
+  bool oks[8];
+  int total = 0;
+  while (total < 3) {
+    int n = cq.NextBatch(tags + total, oks + total, 8 - total);
+    ASSERT_GT(n, 0);
+    total += n;
+  }
+  EXPECT_EQ(total, 3);
+  bool seen[3] = {false, false, false};
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(oks[i]);
+    intptr_t tag = reinterpret_cast<intptr_t>(tags[i]);
+    ASSERT_GE(tag, 1);
+    ASSERT_LE(tag, 3);
+    seen[tag - 1] = true;
+  }
+  EXPECT_TRUE(seen[0] && seen[1] && seen[2]);
+  cq.Shutdown();
+  EXPECT_EQ(cq.NextBatch(tags, oks, 8), 0);
+}
+
+TEST(CompletionQueueTest, NextBatchFiltersInternalTags) {
+  CompletionQueue cq;
+  InternalTag internal_tag;
+  grpc_cq_completion storage;
+  PostInternalTag(&cq, &internal_tag, &storage);
+  Alarm alarm;
+  alarm.Set(&cq, gpr_now(GPR_CLOCK_MONOTONIC), Tag(42));
+  void* tags[4];
+  bool oks[4];
+  // The internal tag is dropped, even if it is the only event in a batch, so
+  // the only event returned is the alarm.
+  int n = cq.NextBatch(tags, oks, 4);
+  ASSERT_EQ(n, 1);
+  EXPECT_EQ(tags[0], Tag(42));
+  EXPECT_TRUE(oks[0]);
+  EXPECT_TRUE(internal_tag.finalized());
+  cq.Shutdown();
+  EXPECT_EQ(cq.NextBatch(tags, oks, 4), 0);
+}
+
+TEST(CompletionQueueTest, AsyncNextBatchTimesOut) {
+  CompletionQueue cq;
+  void* tags[4];
+  bool oks[4];
+  int n = -1;
+  EXPECT_EQ(cq.AsyncNextBatch(tags, oks, 4,
+                              grpc_timeout_milliseconds_to_deadline(10), &n),
+            CompletionQueue::TIMEOUT);
+  EXPECT_EQ(n, -1);
+  // An internal tag alone does not end the wait early.
+  InternalTag internal_tag;
+  grpc_cq_completion storage;
+  PostInternalTag(&cq, &internal_tag, &storage);
+  EXPECT_EQ(cq.AsyncNextBatch(tags, oks, 4,
+                              grpc_timeout_milliseconds_to_deadline(10), &n),
+            CompletionQueue::TIMEOUT);
+  EXPECT_TRUE(internal_tag.finalized());
+  Alarm alarm;
+  alarm.Set(&cq, gpr_now(GPR_CLOCK_MONOTONIC), Tag(7));
+  EXPECT_EQ(cq.AsyncNextBatch(tags, oks, 4,
+                              grpc_timeout_seconds_to_deadline(10), &n),
+            CompletionQueue::GOT_EVENT);
+  EXPECT_EQ(n, 1);
+  EXPECT_EQ(tags[0], Tag(7));
+  cq.Shutdown();
+  EXPECT_EQ(cq.AsyncNextBatch(tags, oks, 4,
+                              grpc_timeout_seconds_to_deadline(10), &n),
+            CompletionQueue::SHUTDOWN);
+}
+
+TEST(CompletionQueueTest, NextBatchDrainsBeforeShutdown) {
+  CompletionQueue cq;
+  Alarm alarm;
+  alarm.Set(&cq, grpc_timeout_milliseconds_to_deadline(100), Tag(1));
+  void* tags[4];
+  bool oks[4];
+  // Shutdown is requested while NextBatch is blocked; the pending alarm is
+  // still returned before NextBatch reports the shutdown.
+  std::thread shutdown_thread([&cq]() { cq.Shutdown(); });
+  int n = cq.NextBatch(tags, oks, 4);
+  shutdown_thread.join();
+  ASSERT_EQ(n, 1);
+  EXPECT_EQ(tags[0], Tag(1));
+  EXPECT_TRUE(oks[0]);
+  EXPECT_EQ(cq.NextBatch(tags, oks, 4), 0);
+}
+
+TEST(CompletionQueueTest, NextBatchUnblocksOnShutdown) {
+  CompletionQueue cq;
+  void* tags[4];
+  bool oks[4];
+  std::thread shutdown_thread([&cq]() {
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(50));
+    cq.Shutdown();
+  });
+  EXPECT_EQ(cq.NextBatch(tags, oks, 4), 0);
+  shutdown_thread.join();
+}
+
+}  // namespace
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
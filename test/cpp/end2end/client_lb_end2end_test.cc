@@ -72,6 +72,7 @@
 #include "src/proto/grpc/health/v1/health.grpc.pb.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "src/proto/grpc/testing/xds/v3/orca_load_report.pb.h"
+#include "test/core/util/fake_udp_and_tcp_server.h"
 #include "test/core/util/port.h"
 #include "test/core/util/resolve_localhost_ip46.h"
 #include "test/core/util/test_config.h"
@@ -425,6 +426,33 @@ class ClientLbEnd2endTest : public ::testing::Test {
     }
   }
 
+  // Sends rounds of concurrent RPCs that each stay in progress on the server
+  // for a while, until server \a server_index has seen \a num_connections
+  // client connections. Returns false if that does not happen in time.
+  bool WaitForServerConnections(
+      const std::unique_ptr<grpc::testing::EchoTestService::Stub>& stub,
+      size_t num_connections, size_t server_index = 0) {
+    const absl::Time deadline =
+        absl::Now() + absl::Seconds(10) * grpc_test_slowdown_factor();
+    while (servers_[server_index]->service_.clients().size() <
+           num_connections) {
+      if (absl::Now() >= deadline) return false;
+      std::vector<std::thread> threads;
+      for (size_t i = 0; i < num_connections + 1; ++i) {
+        threads.emplace_back([&]() {
+          EchoRequest request;
+          request.mutable_param()->set_server_sleep_us(200000);
+          Status status = SendRpc(stub, /*response=*/nullptr,
+                                  /*timeout_ms=*/5000,
+                                  /*wait_for_ready=*/false, &request);
+          EXPECT_TRUE(status.ok()) << status.error_message();
+        });
+      }
+      for (std::thread& thread : threads) thread.join();
+    }
+    return true;
+  }
+
   struct ServerData {
     const int port_;
     std::unique_ptr<Server> server_;
@@ -434,6 +462,11 @@ class ClientLbEnd2endTest : public ::testing::Test {
     std::unique_ptr<std::thread> thread_;
     bool enable_noop_health_check_service_ = false;
     NoopHealthCheckServiceImpl noop_health_check_service_impl_;
+    // If non-zero, the server closes connections after this long.
+    int max_connection_age_ms_ = 0;
+    // If non-zero, the server closes connections without calls after this
+    // long.
+    int max_connection_idle_ms_ = 0;
 
     grpc_core::Mutex mu_;
     grpc_core::CondVar cond_;
@@ -473,6 +506,16 @@ class ClientLbEnd2endTest : public ::testing::Test {
       if (enable_noop_health_check_service_) {
         builder.RegisterService(&noop_health_check_service_impl_);
       }
+      if (max_connection_age_ms_ > 0) {
+        builder.AddChannelArgument(GRPC_ARG_MAX_CONNECTION_AGE_MS,
+                                   max_connection_age_ms_);
+        // Cancel calls on the connection soon after the GOAWAY.
+        builder.AddChannelArgument(GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS, 100);
+      }
+      if (max_connection_idle_ms_ > 0) {
+        builder.AddChannelArgument(GRPC_ARG_MAX_CONNECTION_IDLE_MS,
+                                   max_connection_idle_ms_);
+      }
       grpc::ServerBuilder::experimental_type(&builder)
           .EnableCallMetricRecording(server_metric_recorder_.get());
       server_ = builder.BuildAndStart();
@@ -672,6 +715,142 @@ TEST_F(ClientLbEnd2endTest, ChannelIdleness) {
   EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
 }
 
+TEST_F(ClientLbEnd2endTest, WarmupPing) {
+  StartServers(1);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_WARMUP_PING, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  // The server acks the ping, so the channel becomes READY.
+  EXPECT_TRUE(WaitForChannelReady(channel.get()));
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+}
+
+TEST_F(ClientLbEnd2endTest, WarmupPingBoundedByConnectDeadline) {
+  // A server that completes the HTTP/2 handshake but never acks pings.
+  grpc_core::testing::FakeUdpAndTcpServer fake_server(
+      grpc_core::testing::FakeUdpAndTcpServer::AcceptMode::
+          kEagerlySendSettings,
+      grpc_core::testing::FakeUdpAndTcpServer::CloseSocketUponCloseFromPeer);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_WARMUP_PING, 1);
+  // Sets both the backoff and the minimum connect timeout.
+  args.SetInt("grpc.testing.fixed_reconnect_backoff_ms",
+              1000 * grpc_test_slowdown_factor());
+  // The fake server listens only on [::1] and does not do the fake security
+  // handshake.
+  FakeResolverResponseGeneratorWrapper response_generator(/*ipv6_only=*/true);
+  args.SetPointer(GRPC_ARG_FAKE_RESOLVER_RESPONSE_GENERATOR,
+                  response_generator.Get());
+  auto channel = grpc::CreateCustomChannel(
+      "fake:default.example.com", InsecureChannelCredentials(), args);
+  response_generator.SetNextResolution({fake_server.port()});
+  // The channel gives up on the connection once the connect deadline passes,
+  // without ever reporting READY.
+  auto predicate = [](grpc_connectivity_state state) {
+    EXPECT_NE(state, GRPC_CHANNEL_READY);
+    return state == GRPC_CHANNEL_TRANSIENT_FAILURE;
+  };
+  EXPECT_TRUE(WaitForChannelState(channel.get(), predicate,
+                                  /*try_to_connect=*/true,
+                                  /*timeout_seconds=*/10));
+}
+
+//
+// subchannel connection pool tests
+//
+
+TEST_F(ClientLbEnd2endTest, ConnectionPoolGrowsPastCallsPerConnection) {
+  StartServers(1);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, 2);
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  // Calls on a single connection do not open another one.
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(servers_[0]->service_.clients().size(), 1u);
+  // Concurrent calls open a second connection.
+  EXPECT_TRUE(WaitForServerConnections(stub, 2));
+  // But no more than GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS.
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_TRUE(WaitForServerConnections(stub, 2));
+    std::vector<std::thread> threads;
+    for (size_t j = 0; j < 4; ++j) {
+      threads.emplace_back([&]() { CheckRpcSendOk(DEBUG_LOCATION, stub); });
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+  EXPECT_EQ(servers_[0]->service_.clients().size(), 2u);
+  EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
+}
+
+TEST_F(ClientLbEnd2endTest, ConnectionPoolFailsOverToPooledConnection) {
+  // The first connection is closed while the second one is still open.
+  const int kMaxConnectionAgeMs = 6000 * grpc_test_slowdown_factor();
+  CreateServers(1);
+  servers_[0]->max_connection_age_ms_ = kMaxConnectionAgeMs;
+  StartServer(0);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, 2);
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  // Open the second connection halfway through the first one's lifetime.
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(kMaxConnectionAgeMs /
+                                                        2));
+  EXPECT_TRUE(WaitForServerConnections(stub, 2));
+  // The age limit has 10% jitter. Between the first connection's and the
+  // second one's end, the subchannel stays READY on the second connection.
+  const gpr_timespec after_first_connection = gpr_time_add(
+      start, gpr_time_from_millis(kMaxConnectionAgeMs * 1.15, GPR_TIMESPAN));
+  EXPECT_FALSE(
+      channel->WaitForStateChange(GRPC_CHANNEL_READY, after_first_connection));
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(servers_[0]->service_.clients().size(), 2u);
+}
+
+TEST_F(ClientLbEnd2endTest, ConnectionPoolReplacesLostPooledConnection) {
+  // Calls go to the first connection unless it is busier, so the second one
+  // is closed for being idle while the first one is in use.
+  const int kMaxConnectionIdleMs = 1000 * grpc_test_slowdown_factor();
+  CreateServers(1);
+  servers_[0]->max_connection_idle_ms_ = kMaxConnectionIdleMs;
+  StartServer(0);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, 2);
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_TRUE(WaitForServerConnections(stub, 2));
+  // Keep the first connection busy until the second one has been closed.
+  const absl::Time idle_deadline =
+      absl::Now() + absl::Milliseconds(kMaxConnectionIdleMs * 3);
+  while (absl::Now() < idle_deadline) {
+    EchoRequest request;
+    request.mutable_param()->set_server_sleep_us(50000);
+    Status status = SendRpc(stub, /*response=*/nullptr, /*timeout_ms=*/2000,
+                            /*wait_for_ready=*/false, &request);
+    EXPECT_TRUE(status.ok()) << status.error_message();
+  }
+  EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
+  // The lost connection no longer counts against the pool size, so another
+  // one can be opened in its place.
+  EXPECT_TRUE(WaitForServerConnections(stub, 3));
+}
+
 TEST_F(ClientLbEnd2endTest, AuthorityOverrideOnChannel) {
   StartServers(1);
   // Set authority via channel arg.
@@ -2829,6 +3008,46 @@ TEST_F(OobBackendMetricTest, Basic) {
   ASSERT_TRUE(report_seen);
 }
 
+TEST_F(OobBackendMetricTest, ReportsMoveToPooledConnection) {
+  // The first connection is closed while the second one is still open.
+  const int kMaxConnectionAgeMs = 10000 * grpc_test_slowdown_factor();
+  CreateServers(1);
+  servers_[0]->max_connection_age_ms_ = kMaxConnectionAgeMs;
+  StartServer(0);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, 2);
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CALLS_PER_CONNECTION, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel =
+      BuildChannel("oob_backend_metric_test_lb", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(kMaxConnectionAgeMs /
+                                                        2));
+  EXPECT_TRUE(WaitForServerConnections(stub, 2));
+  // Wait for the first connection, which carries the ORCA stream, to be
+  // closed. The age limit has 10% jitter.
+  gpr_sleep_until(gpr_time_add(
+      start, gpr_time_from_millis(kMaxConnectionAgeMs * 1.15, GPR_TIMESPAN)));
+  ASSERT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
+  // Reports keep coming over the second connection.
+  while (GetBackendMetricReport().has_value()) {
+  }
+  bool report_seen = false;
+  for (size_t i = 0; i < 10; ++i) {
+    auto report = GetBackendMetricReport();
+    if (report.has_value()) {
+      EXPECT_EQ(report->first, servers_[0]->port_);
+      report_seen = true;
+      break;
+    }
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(200));
+  }
+  EXPECT_TRUE(report_seen);
+}
+
 //
 // tests rewriting of control plane status codes
 //
@@ -0,0 +1,274 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/server_callback.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Echoes unary requests and every message of a bidi stream. All reactions
+// are non-blocking, as inline reactors require, and the bidi reactor starts
+// its next operation from within the previous one's reaction.
+class InlineEchoService : public EchoTestService::CallbackService {
+ public:
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    response->set_message(request->message());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerBidiReactor<EchoRequest, EchoResponse>* BidiStream(
+      CallbackServerContext* /*context*/) override {
+    class Reactor : public ServerBidiReactor<EchoRequest, EchoResponse> {
+     public:
+      Reactor() { StartRead(&request_); }
+
+      void OnReadDone(bool ok) override {
+        if (!ok) {
+          Finish(Status::OK);
+          return;
+        }
+        response_.set_message(request_.message());
+        StartWrite(&response_);
+      }
+
+      void OnWriteDone(bool ok) override {
+        if (!ok) {
+          Finish(Status(StatusCode::UNKNOWN, "write failed"));
+          return;
+        }
+        StartRead(&request_);
+      }
+
+      void OnDone() override { delete this; }
+
+     private:
+      EchoRequest request_;
+      EchoResponse response_;
+    };
+    return new Reactor();
+  }
+};
+
+// Writes kNumMessages messages one at a time, each once both the previous
+// write and the read of its echo are done, then half-closes.
+class BidiClient : public ClientBidiReactor<EchoRequest, EchoResponse> {
+ public:
+  static constexpr int kNumMessages = 20;
+
+  BidiClient(EchoTestService::Stub* stub, bool inline_reactors) {
+    context_.set_inline_reactors(inline_reactors);
+    stub->async()->BidiStream(&context_, this);
+    StartRound();
+    StartCall();
+  }
+
+  void OnWriteDone(bool ok) override {
+    EXPECT_TRUE(ok);
+    MaybeFinishRound();
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) return;
+    received_.push_back(response_.message());
+    MaybeFinishRound();
+  }
+
+  void OnDone(const Status& s) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    status_ = s;
+    done_ = true;
+    cv_.notify_one();
+  }
+
+  // Waits for the call to finish and returns its status.
+  Status Await() {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this] { return done_; });
+    return status_;
+  }
+
+  const std::vector<std::string>& received() const { return received_; }
+
+ private:
+  void StartRound() {
+    pending_.store(2, std::memory_order_relaxed);
+    request_.set_message(absl::StrCat("message ", next_++));
+    StartWrite(&request_);
+    StartRead(&response_);
+  }
+
+  // The write and the read of a round may complete on different threads;
+  // whichever finishes last starts the next round.
+  void MaybeFinishRound() {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    if (next_ == kNumMessages) {
+      StartWritesDone();
+    } else {
+      StartRound();
+    }
+  }
+
+  ClientContext context_;
+  EchoRequest request_;
+  EchoResponse response_;
+  std::atomic<int> pending_{0};
+  int next_ = 0;
+  std::vector<std::string> received_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool done_ = false;
+  Status status_;
+};
+
+class InlineCallbackReactorsTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    ServerBuilder builder;
+    builder.RegisterService(&service_);
+    builder.experimental().EnableInlineCallbackReactors();
+    if (UseInProcess()) {
+      server_ = builder.BuildAndStart();
+      channel_ = server_->InProcessChannel(ChannelArguments());
+    } else {
+      std::string address =
+          absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+      builder.AddListeningPort(address, InsecureServerCredentials());
+      server_ = builder.BuildAndStart();
+      channel_ = grpc::CreateChannel(address, InsecureChannelCredentials());
+    }
+    stub_ = EchoTestService::NewStub(channel_);
+  }
+
+  void TearDown() override { server_->Shutdown(); }
+
+  bool UseInProcess() const { return GetParam(); }
+
+  // Sends \a num_rpcs unary RPCs concurrently with inline reactors and checks
+  // that each one is echoed.
+  void EchoConcurrently(int num_rpcs) {
+    struct Rpc {
+      ClientContext context;
+      EchoRequest request;
+      EchoResponse response;
+      Status status;
+    };
+    std::vector<Rpc> rpcs(num_rpcs);
+    std::mutex mu;
+    std::condition_variable cv;
+    int remaining = num_rpcs;
+    for (int i = 0; i < num_rpcs; ++i) {
+      Rpc& rpc = rpcs[i];
+      rpc.context.set_inline_reactors(true);
+      rpc.request.set_message(absl::StrCat("rpc ", i));
+      stub_->async()->Echo(&rpc.context, &rpc.request, &rpc.response,
+                           [&rpc, &mu, &cv, &remaining](Status s) {
+                             std::lock_guard<std::mutex> lock(mu);
+                             rpc.status = std::move(s);
+                             if (--remaining == 0) cv.notify_one();
+                           });
+    }
+    std::unique_lock<std::mutex> lock(mu);
+    cv.wait(lock, [&remaining] { return remaining == 0; });
+    for (int i = 0; i < num_rpcs; ++i) {
+      EXPECT_TRUE(rpcs[i].status.ok()) << rpcs[i].status.error_message();
+      EXPECT_EQ(rpcs[i].response.message(), absl::StrCat("rpc ", i));
+    }
+  }
+
+  InlineEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::shared_ptr<Channel> channel_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_P(InlineCallbackReactorsTest, Unary) {
+  for (int i = 0; i < 10; ++i) EchoConcurrently(1);
+}
+
+TEST_P(InlineCallbackReactorsTest, ConcurrentUnary) { EchoConcurrently(50); }
+
+TEST_P(InlineCallbackReactorsTest, BidiStreaming) {
+  BidiClient client(stub_.get(), /*inline_reactors=*/true);
+  Status status = client.Await();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  ASSERT_EQ(client.received().size(),
+            static_cast<size_t>(BidiClient::kNumMessages));
+  for (int i = 0; i < BidiClient::kNumMessages; ++i) {
+    EXPECT_EQ(client.received()[i], absl::StrCat("message ", i));
+  }
+}
+
+TEST_P(InlineCallbackReactorsTest, ConcurrentBidiStreaming) {
+  // Mixing inline and non-inline clients on the same channel is allowed.
+  std::vector<std::unique_ptr<BidiClient>> clients;
+  for (int i = 0; i < 10; ++i) {
+    clients.push_back(std::make_unique<BidiClient>(
+        stub_.get(), /*inline_reactors=*/i % 2 == 0));
+  }
+  for (auto& client : clients) {
+    Status status = client->Await();
+    EXPECT_TRUE(status.ok()) << status.error_message();
+    EXPECT_EQ(client->received().size(),
+              static_cast<size_t>(BidiClient::kNumMessages));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(InlineCallbackReactors, InlineCallbackReactorsTest,
+                         ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "InProcess" : "Tcp";
+                         });
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
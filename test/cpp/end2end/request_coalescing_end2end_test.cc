@@ -0,0 +1,335 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/client_callback.h>
+
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Call credentials that add a fixed bearer token.
+class TokenCredentialsPlugin : public MetadataCredentialsPlugin {
+ public:
+  explicit TokenCredentialsPlugin(std::string token)
+      : token_(std::move(token)) {}
+
+  bool IsBlocking() const override { return false; }
+
+  Status GetMetadata(
+      string_ref /*service_url*/, string_ref /*method_name*/,
+      const AuthContext& /*channel_auth_context*/,
+      std::multimap<std::string, std::string>* metadata) override {
+    metadata->emplace("authorization", absl::StrCat("Bearer ", token_));
+    return Status::OK;
+  }
+
+ private:
+  std::string token_;
+};
+
+std::shared_ptr<CallCredentials> TokenCredentials(std::string token) {
+  // The test channel is insecure, so allow the credentials on it.
+  return experimental::MetadataCredentialsFromPlugin(
+      std::make_unique<TokenCredentialsPlugin>(std::move(token)),
+      GRPC_SECURITY_NONE);
+}
+
+// Echo service whose handlers block until released, so that the test controls
+// how long each call stays in flight.
+class BlockingEchoService : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    std::unique_lock<std::mutex> lock(mu_);
+    ++calls_;
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return released_; });
+    if (request->has_param() && request->param().has_expected_error()) {
+      const auto& error = request->param().expected_error();
+      return Status(static_cast<StatusCode>(error.code()),
+                    error.error_message());
+    }
+    response->set_message(request->message());
+    return Status::OK;
+  }
+
+  void WaitForCalls(int calls) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this, calls] { return calls_ >= calls; });
+  }
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mu_);
+    released_ = true;
+    cv_.notify_all();
+  }
+
+  int calls() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return calls_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int calls_ = 0;
+  bool released_ = false;
+};
+
+class RequestCoalescingEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    server_address_ =
+        grpc_core::JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address_, InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    ChannelArguments args;
+    args.SetServiceConfigJSON(
+        "{\"methodConfig\": [{"
+        "  \"name\": [{\"service\": \"grpc.testing.EchoTestService\","
+        "              \"method\": \"Echo\"}],"
+        "  \"coalesceIdenticalRequests\": true"
+        "}]}");
+    auto channel = CreateCustomChannel(server_address_,
+                                       InsecureChannelCredentials(), args);
+    // Once the channel is connected, calls reach the coalescing filter as
+    // soon as they are started.
+    ASSERT_TRUE(
+        channel->WaitForConnected(grpc_timeout_seconds_to_deadline(30)));
+    stub_ = EchoTestService::NewStub(channel);
+  }
+
+  void TearDown() override {
+    service_.Release();
+    server_->Shutdown();
+  }
+
+  // One asynchronous Echo call.
+  class Rpc {
+   public:
+    Rpc(EchoTestService::Stub* stub, const EchoRequest& request,
+        const std::function<void(ClientContext*)>& setup_context)
+        : request_(request) {
+      if (setup_context != nullptr) setup_context(&context_);
+      stub->async()->Echo(&context_, &request_, &response_, [this](Status s) {
+        std::lock_guard<std::mutex> lock(mu_);
+        status_ = std::move(s);
+        done_ = true;
+        cv_.notify_one();
+      });
+    }
+
+    void Cancel() { context_.TryCancel(); }
+
+    // Waits for the call to finish and returns its status.
+    Status Await() {
+      std::unique_lock<std::mutex> lock(mu_);
+      cv_.wait(lock, [this] { return done_; });
+      return status_;
+    }
+
+    const EchoResponse& response() const { return response_; }
+
+   private:
+    ClientContext context_;
+    EchoRequest request_;
+    EchoResponse response_;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    Status status_;
+  };
+
+  std::unique_ptr<Rpc> StartEcho(
+      const EchoRequest& request,
+      const std::function<void(ClientContext*)>& setup_context = nullptr) {
+    return std::make_unique<Rpc>(stub_.get(), request, setup_context);
+  }
+
+  std::unique_ptr<Rpc> StartEcho(
+      const std::string& message,
+      const std::function<void(ClientContext*)>& setup_context = nullptr) {
+    EchoRequest request;
+    request.set_message(message);
+    return StartEcho(request, setup_context);
+  }
+
+  // Waits for rpcs to finish and checks that each one echoed "same".
+  static void ExpectAllEchoedSame(
+      const std::vector<std::unique_ptr<Rpc>>& rpcs) {
+    for (const auto& rpc : rpcs) {
+      Status status = rpc->Await();
+      EXPECT_TRUE(status.ok()) << status.error_message();
+      EXPECT_EQ(rpc->response().message(), "same");
+    }
+  }
+
+  // Starts one call per message, releases the server once it has seen
+  // expected_server_calls calls, and returns the responses in order.
+  std::vector<std::string> EchoAll(const std::vector<std::string>& messages,
+                                   int expected_server_calls) {
+    std::vector<std::unique_ptr<Rpc>> rpcs;
+    for (const std::string& message : messages) {
+      rpcs.push_back(StartEcho(message));
+    }
+    service_.WaitForCalls(expected_server_calls);
+    service_.Release();
+    std::vector<std::string> responses;
+    for (auto& rpc : rpcs) {
+      Status status = rpc->Await();
+      EXPECT_TRUE(status.ok()) << status.error_message();
+      responses.push_back(rpc->response().message());
+    }
+    return responses;
+  }
+
+  std::string server_address_;
+  BlockingEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(RequestCoalescingEnd2endTest, IdenticalCallsShareOneServerCall) {
+  std::vector<std::string> messages(5, "same");
+  EXPECT_EQ(EchoAll(messages, 1), messages);
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+TEST_F(RequestCoalescingEnd2endTest, DifferentRequestsAreNotCoalesced) {
+  std::vector<std::string> messages = {"a", "b", "a", "c"};
+  EXPECT_EQ(EchoAll(messages, 3), messages);
+  EXPECT_EQ(service_.calls(), 3);
+}
+
+TEST_F(RequestCoalescingEnd2endTest,
+       CallsWithDifferentMetadataAreNotCoalesced) {
+  std::vector<std::unique_ptr<Rpc>> rpcs;
+  for (const char* user : {"alice", "bob", "alice"}) {
+    rpcs.push_back(StartEcho("same", [user](ClientContext* context) {
+      context->AddMetadata("x-user", user);
+    }));
+  }
+  service_.WaitForCalls(2);
+  service_.Release();
+  ExpectAllEchoedSame(rpcs);
+  EXPECT_EQ(service_.calls(), 2);
+}
+
+TEST_F(RequestCoalescingEnd2endTest,
+       CallsWithCallCredentialsAreNotCoalesced) {
+  std::vector<std::unique_ptr<Rpc>> rpcs;
+  for (const char* token : {"alice-token", "bob-token"}) {
+    rpcs.push_back(StartEcho("same", [token](ClientContext* context) {
+      context->set_credentials(TokenCredentials(token));
+    }));
+  }
+  service_.WaitForCalls(2);
+  service_.Release();
+  ExpectAllEchoedSame(rpcs);
+  EXPECT_EQ(service_.calls(), 2);
+}
+
+TEST_F(RequestCoalescingEnd2endTest, LeaderCancelFailsFollowers) {
+  auto leader = StartEcho("same");
+  service_.WaitForCalls(1);
+  auto follower1 = StartEcho("same");
+  auto follower2 = StartEcho("same");
+  leader->Cancel();
+  EXPECT_EQ(leader->Await().error_code(), StatusCode::CANCELLED);
+  // The followers did not ask to be cancelled, so they see the leader's
+  // cancellation as UNAVAILABLE.
+  EXPECT_EQ(follower1->Await().error_code(), StatusCode::UNAVAILABLE);
+  EXPECT_EQ(follower2->Await().error_code(), StatusCode::UNAVAILABLE);
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+TEST_F(RequestCoalescingEnd2endTest, FollowerCancelDoesNotAffectOthers) {
+  auto leader = StartEcho("same");
+  service_.WaitForCalls(1);
+  auto follower1 = StartEcho("same");
+  auto follower2 = StartEcho("same");
+  follower1->Cancel();
+  // The cancelled follower finishes without waiting for the leader.
+  EXPECT_EQ(follower1->Await().error_code(), StatusCode::CANCELLED);
+  service_.Release();
+  Status status = leader->Await();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(leader->response().message(), "same");
+  status = follower2->Await();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(follower2->response().message(), "same");
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+TEST_F(RequestCoalescingEnd2endTest, LeaderFailureIsSharedWithFollowers) {
+  EchoRequest request;
+  request.set_message("same");
+  request.mutable_param()->mutable_expected_error()->set_code(
+      static_cast<int32_t>(StatusCode::FAILED_PRECONDITION));
+  request.mutable_param()->mutable_expected_error()->set_error_message(
+      "leader failed");
+  auto leader = StartEcho(request);
+  service_.WaitForCalls(1);
+  auto follower1 = StartEcho(request);
+  auto follower2 = StartEcho(request);
+  service_.Release();
+  for (Rpc* rpc : {leader.get(), follower1.get(), follower2.get()}) {
+    Status status = rpc->Await();
+    EXPECT_EQ(status.error_code(), StatusCode::FAILED_PRECONDITION);
+    EXPECT_EQ(status.error_message(), "leader failed");
+  }
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
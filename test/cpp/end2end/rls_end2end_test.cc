@@ -21,6 +21,7 @@
 //   fires; request is processed at that point
 // - find some deterministic way to exercise adaptive throttler code
 
+#include <atomic>
 #include <deque>
 #include <map>
 #include <thread>
@@ -43,6 +44,8 @@
 #include "src/core/ext/filters/client_channel/resolver/fake/fake_resolver.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/time.h"
@@ -1229,6 +1232,261 @@ TEST_F(RlsEnd2endTest, CacheSizeLimit) {
   EXPECT_EQ(backends_[1]->service_.request_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, FreshCacheHitsDoNotTakeLock) {
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  // The first RPC has no cache entry, so it goes through the locked path.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  // Later RPCs for the same key are served from the published entry.
+  auto before = grpc_core::global_stats().Collect();
+  for (int i = 0; i < 10; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue}}));
+  }
+  auto after = grpc_core::global_stats().Collect();
+  EXPECT_EQ(after->rls_lock_free_picks - before->rls_lock_free_picks, 10u);
+  EXPECT_EQ(after->rls_locked_picks - before->rls_locked_picks, 0u);
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 11);
+}
+
+TEST_F(RlsEnd2endTest, StaleCacheEntryTakesLockedPath) {
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_max_age(grpc_core::Duration::Seconds(5))
+          .set_stale_age(grpc_core::Duration::Seconds(1))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  rls_server_->service_.RemoveResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}},
+                      RouteLookupRequest::REASON_STALE),
+      BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  // Wait longer than stale age.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  // Only the locked path can start the refresh, so the stale entry is not
+  // used without the lock, even though its data has not expired.
+  auto before = grpc_core::global_stats().Collect();
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  auto after = grpc_core::global_stats().Collect();
+  EXPECT_EQ(after->rls_lock_free_picks - before->rls_lock_free_picks, 0u);
+  EXPECT_EQ(after->rls_locked_picks - before->rls_locked_picks, 1u);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 2);
+  // Wait for RLS server to receive the second request.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+  // Once refreshed, the entry is served without the lock again.
+  before = grpc_core::global_stats().Collect();
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  after = grpc_core::global_stats().Collect();
+  EXPECT_EQ(after->rls_lock_free_picks - before->rls_lock_free_picks, 1u);
+  EXPECT_EQ(after->rls_locked_picks - before->rls_locked_picks, 0u);
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+}
+
+TEST_F(RlsEnd2endTest, ExpiredCacheEntryTakesLockedPath) {
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_max_age(grpc_core::Duration::Seconds(1))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  // Wait for cache to be expired.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  // The expired entry is not used. The locked path starts a new RLS request
+  // and queues the pick until the response arrives.
+  auto before = grpc_core::global_stats().Collect();
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  auto after = grpc_core::global_stats().Collect();
+  EXPECT_GE(after->rls_locked_picks - before->rls_locked_picks, 1u);
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 2);
+}
+
+TEST_F(RlsEnd2endTest, CacheEvictionGivesReferencedEntriesSecondChance) {
+  // Long key values make each entry a bit over 4000 bytes, so that the cache
+  // holds three entries but not four.
+  const std::string kValueA(2000, 'a');
+  const std::string kValueB(2000, 'b');
+  const std::string kValueC(2000, 'c');
+  const std::string kValueD(2000, 'd');
+  const std::string kValueE(2000, 'e');
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_cache_size_bytes(16000)
+          .Build());
+  for (const std::string& value :
+       {kValueA, kValueB, kValueC, kValueD, kValueE}) {
+    rls_server_->service_.SetResponse(
+        BuildRlsRequest({{kTestKey, value}}),
+        BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  }
+  auto send = [&](const std::string& value) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", value}}));
+  };
+  // Fill the cache. Each RPC is re-picked without the lock once its RLS
+  // response arrives, which marks its entry as referenced.
+  send(kValueA);
+  send(kValueB);
+  send(kValueC);
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  // Wait for min_eviction_time to elapse.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(6));
+  // Adding D makes room by evicting one entry. A, B and C were all
+  // referenced, so each gets its second chance, which clears its bit, and A,
+  // the least recently used, is evicted. The LRU order is now B, C, D.
+  send(kValueD);
+  EXPECT_EQ(rls_server_->service_.request_count(), 4);
+  // A fresh hit on B cannot move it in the LRU list, but marks it referenced.
+  send(kValueB);
+  EXPECT_EQ(rls_server_->service_.request_count(), 4);
+  // Adding E evicts C rather than B, which gets a second chance.
+  send(kValueE);
+  EXPECT_EQ(rls_server_->service_.request_count(), 5);
+  send(kValueB);
+  EXPECT_EQ(rls_server_->service_.request_count(), 5);
+  send(kValueC);
+  EXPECT_EQ(rls_server_->service_.request_count(), 6);
+}
+
+TEST_F(RlsEnd2endTest, ConcurrentPicksDuringResizeAndShutdown) {
+  StartBackends(1);
+  auto make_config = [&](int64_t cache_size_bytes) {
+    return MakeServiceConfigBuilder()
+        .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                       "  \"service\":\"%s\","
+                                       "  \"method\":\"%s\""
+                                       "}],"
+                                       "\"headers\":["
+                                       "  {"
+                                       "    \"key\":\"%s\","
+                                       "    \"names\":["
+                                       "      \"key1\""
+                                       "    ]"
+                                       "  }"
+                                       "]",
+                                       kServiceValue, kMethodValue, kTestKey))
+        .set_cache_size_bytes(cache_size_bytes)
+        .Build();
+  };
+  SetNextResolution(make_config(10485760));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({TargetStringForPort(backends_[0]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  // Wait for min_eviction_time to elapse, so that shrinking the cache
+  // actually evicts the entry that the picks are using.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(6));
+  std::atomic<bool> stop{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      while (!stop.load(std::memory_order_relaxed)) {
+        Status status = SendRpc(RpcOptions()
+                                    .set_metadata({{"key1", kTestValue}})
+                                    .set_wait_for_ready(true)
+                                    .set_timeout_ms(5000));
+        if (!status.ok()) failures.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  // Resize the cache back and forth while the picks are running.
+  for (int i = 0; i < 20; ++i) {
+    SetNextResolution(make_config(i % 2 == 0 ? 1 : 10485760));
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(50));
+  }
+  // Replace the RLS policy, which shuts its cache down under the picks.
+  SetNextResolution(absl::StrFormat(
+      "{\"loadBalancingConfig\":[{\"fixed_address_lb\":{\"address\":\"%s\"}}]}",
+      TargetStringForPort(backends_[0]->port_)));
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(failures.load(), 0);
+  // The entry was evicted at least once, so it had to be looked up again.
+  EXPECT_GT(rls_server_->service_.request_count(), 1);
+}
+
 TEST_F(RlsEnd2endTest, MultipleTargets) {
   StartBackends(1);
   SetNextResolution(
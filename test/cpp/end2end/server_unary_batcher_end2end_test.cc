@@ -0,0 +1,180 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/server_unary_batcher.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using Batcher = experimental::ServerUnaryBatcher<EchoRequest, EchoResponse>;
+
+class BatchingEchoService : public EchoTestService::CallbackService {
+ public:
+  BatchingEchoService(size_t max_batch_size,
+                      std::chrono::system_clock::duration max_delay)
+      : batcher_(max_batch_size, max_delay,
+                 [this](std::vector<Batcher::Entry>* batch) {
+                   OnBatch(batch);
+                 }) {}
+
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    return batcher_.Add(context, request, response);
+  }
+
+  std::vector<size_t> batch_sizes() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return batch_sizes_;
+  }
+
+ private:
+  void OnBatch(std::vector<Batcher::Entry>* batch) {
+    for (Batcher::Entry& entry : *batch) {
+      if (entry.request->message() == "fail") {
+        entry.status = Status(StatusCode::INVALID_ARGUMENT, "fail");
+      } else {
+        entry.response->set_message(entry.request->message());
+      }
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    batch_sizes_.push_back(batch->size());
+  }
+
+  std::mutex mu_;
+  std::vector<size_t> batch_sizes_;
+  Batcher batcher_;
+};
+
+class ServerUnaryBatcherTest : public ::testing::Test {
+ protected:
+  void StartServer(size_t max_batch_size,
+                   std::chrono::system_clock::duration max_delay) {
+    service_ = std::make_unique<BatchingEchoService>(max_batch_size, max_delay);
+    ServerBuilder builder;
+    builder.RegisterService(service_.get());
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(server_->InProcessChannel(
+        ChannelArguments()));
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) server_->Shutdown();
+  }
+
+  // Sends one unary RPC per message, all concurrently, and returns their
+  // results in order.
+  std::vector<std::pair<Status, std::string>> EchoAll(
+      const std::vector<std::string>& messages) {
+    struct Rpc {
+      ClientContext context;
+      EchoRequest request;
+      EchoResponse response;
+      Status status;
+    };
+    std::vector<Rpc> rpcs(messages.size());
+    std::mutex mu;
+    std::condition_variable cv;
+    size_t remaining = messages.size();
+    for (size_t i = 0; i < messages.size(); ++i) {
+      Rpc& rpc = rpcs[i];
+      rpc.request.set_message(messages[i]);
+      stub_->async()->Echo(&rpc.context, &rpc.request, &rpc.response,
+                           [&rpc, &mu, &cv, &remaining](Status s) {
+                             std::lock_guard<std::mutex> lock(mu);
+                             rpc.status = std::move(s);
+                             if (--remaining == 0) cv.notify_one();
+                           });
+    }
+    std::unique_lock<std::mutex> lock(mu);
+    cv.wait(lock, [&remaining] { return remaining == 0; });
+    std::vector<std::pair<Status, std::string>> results;
+    for (Rpc& rpc : rpcs) {
+      results.emplace_back(rpc.status, rpc.response.message());
+    }
+    return results;
+  }
+
+  std::unique_ptr<BatchingEchoService> service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(ServerUnaryBatcherTest, FullBatchesDoNotWaitForTheDelay) {
+  // With an effectively infinite delay the RPCs only complete if full batches
+  // are dispatched straight away.
+  StartServer(4, std::chrono::hours(1));
+  std::vector<std::string> messages;
+  for (int i = 0; i < 8; ++i) messages.push_back(std::to_string(i));
+  auto results = EchoAll(messages);
+  for (size_t i = 0; i < messages.size(); ++i) {
+    EXPECT_TRUE(results[i].first.ok()) << results[i].first.error_message();
+    EXPECT_EQ(results[i].second, messages[i]);
+  }
+  EXPECT_EQ(service_->batch_sizes(), std::vector<size_t>({4, 4}));
+}
+
+TEST_F(ServerUnaryBatcherTest, PartialBatchIsDispatchedAfterTheDelay) {
+  StartServer(100, std::chrono::milliseconds(10));
+  auto results = EchoAll({"a", "b", "c"});
+  EXPECT_EQ(results[0].second, "a");
+  EXPECT_EQ(results[1].second, "b");
+  EXPECT_EQ(results[2].second, "c");
+  std::vector<size_t> batch_sizes = service_->batch_sizes();
+  EXPECT_EQ(std::accumulate(batch_sizes.begin(), batch_sizes.end(), size_t{0}),
+            3);
+  for (size_t size : batch_sizes) EXPECT_LE(size, 100);
+}
+
+TEST_F(ServerUnaryBatcherTest, EachRpcIsFinishedWithItsOwnStatus) {
+  StartServer(2, std::chrono::hours(1));
+  auto results = EchoAll({"ok", "fail"});
+  EXPECT_TRUE(results[0].first.ok());
+  EXPECT_EQ(results[0].second, "ok");
+  EXPECT_EQ(results[1].first.error_code(), StatusCode::INVALID_ARGUMENT);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
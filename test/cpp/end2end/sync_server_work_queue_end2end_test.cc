@@ -0,0 +1,214 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/client_callback.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr int kMaxWorkers = 2;
+constexpr int kMaxQueuedRpcs = 3;
+
+// Echo service whose handlers block until released, so that the test controls
+// how long each worker stays busy.
+class BlockingEchoService : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    std::unique_lock<std::mutex> lock(mu_);
+    ++calls_;
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return released_; });
+    response->set_message(request->message());
+    return Status::OK;
+  }
+
+  void WaitForCalls(int calls) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this, calls] { return calls_ >= calls; });
+  }
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mu_);
+    released_ = true;
+    cv_.notify_all();
+  }
+
+  int calls() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return calls_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int calls_ = 0;
+  bool released_ = false;
+};
+
+// Records the outcome of asynchronous Echo calls.
+class RpcTracker {
+ public:
+  void Done(const Status& status) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (status.ok()) {
+      ++ok_;
+    } else {
+      EXPECT_EQ(status.error_code(), StatusCode::RESOURCE_EXHAUSTED)
+          << status.error_message();
+      ++rejected_;
+    }
+    cv_.notify_all();
+  }
+
+  // Waits until at least n calls have been rejected.
+  void WaitForRejected(int n) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this, n] { return rejected_ >= n; });
+  }
+
+  // Waits until n calls have finished.
+  void WaitForDone(int n) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this, n] { return ok_ + rejected_ >= n; });
+  }
+
+  int ok() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return ok_;
+  }
+
+  int rejected() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return rejected_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int ok_ = 0;
+  int rejected_ = 0;
+};
+
+class SyncServerWorkQueueEnd2endTest : public ::testing::Test {
+ protected:
+  struct Rpc {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+  };
+
+  void SetUp() override {
+    server_address_ =
+        grpc_core::JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address_, InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    builder.SetSyncServerOption(ServerBuilder::SyncServerOption::NUM_CQS, 1);
+    builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MIN_POLLERS,
+                                1);
+    builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MAX_POLLERS,
+                                1);
+    builder.experimental().SetSyncServerWorkQueueSize(kMaxQueuedRpcs);
+    builder.experimental().SetSyncServerMaxWorkers(kMaxWorkers);
+    server_ = builder.BuildAndStart();
+    auto channel =
+        grpc::CreateChannel(server_address_, InsecureChannelCredentials());
+    ASSERT_TRUE(
+        channel->WaitForConnected(grpc_timeout_seconds_to_deadline(30)));
+    stub_ = EchoTestService::NewStub(channel);
+  }
+
+  void TearDown() override {
+    service_.Release();
+    server_->Shutdown();
+  }
+
+  void StartEcho() {
+    rpcs_.push_back(std::make_unique<Rpc>());
+    Rpc* rpc = rpcs_.back().get();
+    rpc->request.set_message("hello");
+    stub_->async()->Echo(&rpc->context, &rpc->request, &rpc->response,
+                         [this](Status s) { tracker_.Done(s); });
+  }
+
+  std::string server_address_;
+  BlockingEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+  std::vector<std::unique_ptr<Rpc>> rpcs_;
+  RpcTracker tracker_;
+};
+
+TEST_F(SyncServerWorkQueueEnd2endTest, RejectsRpcsBeyondWorkersAndQueue) {
+  auto before = grpc_core::global_stats().Collect();
+  // Occupy every worker.
+  for (int i = 0; i < kMaxWorkers; ++i) StartEcho();
+  service_.WaitForCalls(kMaxWorkers);
+  // The next kMaxQueuedRpcs RPCs wait in the queue, and the rest are turned
+  // away while the workers are still busy.
+  constexpr int kExtraRpcs = 5;
+  for (int i = 0; i < kMaxQueuedRpcs + kExtraRpcs; ++i) StartEcho();
+  tracker_.WaitForRejected(kExtraRpcs);
+  // No worker beyond the limit was started for the queued RPCs.
+  EXPECT_EQ(service_.calls(), kMaxWorkers);
+  service_.Release();
+  const int total = kMaxWorkers + kMaxQueuedRpcs + kExtraRpcs;
+  tracker_.WaitForDone(total);
+  EXPECT_EQ(tracker_.ok(), kMaxWorkers + kMaxQueuedRpcs);
+  EXPECT_EQ(tracker_.rejected(), kExtraRpcs);
+  EXPECT_EQ(service_.calls(), kMaxWorkers + kMaxQueuedRpcs);
+  auto after = grpc_core::global_stats().Collect();
+  EXPECT_EQ(after->sync_server_requests_rejected -
+                before->sync_server_requests_rejected,
+            static_cast<uint64_t>(kExtraRpcs));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
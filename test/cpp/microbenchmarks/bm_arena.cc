@@ -39,6 +39,19 @@ static void BM_Arena_NoOp(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_NoOp)->Range(1, 1024 * 1024);
 
+static void BM_Arena_NoOpPooledStorage(benchmark::State& state) {
+  grpc_core::MemoryAllocator memory_allocator =
+      grpc_core::MemoryAllocator(grpc_core::ResourceQuota::Default()
+                                     ->memory_quota()
+                                     ->CreateMemoryAllocator("test"));
+  grpc_core::ArenaStoragePool pool(&memory_allocator);
+  for (auto _ : state) {
+    Arena::CreateWithAlloc(state.range(0), 0, &memory_allocator, &pool)
+        .first->Destroy();
+  }
+}
+BENCHMARK(BM_Arena_NoOpPooledStorage)->Range(1, 1024 * 1024);
+
 static void BM_Arena_ManyAlloc(benchmark::State& state) {
   grpc_core::MemoryAllocator memory_allocator =
       grpc_core::MemoryAllocator(grpc_core::ResourceQuota::Default()
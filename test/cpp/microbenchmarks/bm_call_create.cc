@@ -42,8 +42,12 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
 #include "src/core/lib/channel/connected_channel.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/call_combiner.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/transport_impl.h"
@@ -108,9 +112,24 @@ class LameChannel : public BaseChannelFixture {
             "localhost:1234", GRPC_STATUS_UNAUTHENTICATED, "blah")) {}
 };
 
+// Which call implementation calls on \a channel use. Promise based calls are
+// selected by the promise_based_client_call experiment, so compare them with
+// filter stack calls by running with and without
+// GRPC_EXPERIMENTS=promise_based_client_call.
+static bool UsesPromiseBasedCalls(grpc_channel* channel) {
+  return grpc_core::IsPromiseBasedClientCallEnabled() &&
+         grpc_core::Channel::FromC(channel)->is_promising();
+}
+
+static const char* CallImplementationLabel(grpc_channel* channel) {
+  return UsesPromiseBasedCalls(channel) ? "promise_based_call"
+                                        : "filter_stack_call";
+}
+
 template <class Fixture>
 static void BM_CallCreateDestroy(benchmark::State& state) {
   Fixture fixture;
+  state.SetLabel(CallImplementationLabel(fixture.channel()));
   grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   void* method_hdl = grpc_channel_register_call(fixture.channel(), "/foo/bar",
@@ -173,6 +192,7 @@ static void BM_LameChannelCallCreateCore(benchmark::State& state) {
 
   channel = grpc_lame_client_channel_create(
       "localhost:1234", GRPC_STATUS_UNAUTHENTICATED, "blah");
+  state.SetLabel(CallImplementationLabel(channel));
   cq = grpc_completion_queue_create_for_next(nullptr);
   void* rc = grpc_channel_register_call(
       channel, "/grpc.testing.EchoTestService/Echo", nullptr, nullptr);
@@ -243,6 +263,7 @@ static void BM_LameChannelCallCreateCoreSeparateBatch(benchmark::State& state) {
 
   channel = grpc_lame_client_channel_create(
       "localhost:1234", GRPC_STATUS_UNAUTHENTICATED, "blah");
+  state.SetLabel(CallImplementationLabel(channel));
   cq = grpc_completion_queue_create_for_next(nullptr);
   void* rc = grpc_channel_register_call(
       channel, "/grpc.testing.EchoTestService/Echo", nullptr, nullptr);
@@ -825,6 +846,182 @@ static void BM_IsolatedCall_StreamingSend(benchmark::State& state) {
 }
 BENCHMARK(BM_IsolatedCall_StreamingSend);
 
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks a full unary batch through each client call implementation
+
+namespace unary_terminal_filter {
+
+// Terminates the stack: consumes every message the client sends, then
+// completes the call with an OK status. Unlike the lame channel, calls on it
+// go all the way through sending their message and half-closing, which is
+// what the unary fast path of promise based calls changes.
+class UnaryTerminalFilter : public grpc_core::ChannelFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<UnaryTerminalFilter> Create(
+      const grpc_core::ChannelArgs&, ChannelFilter::Args) {
+    return UnaryTerminalFilter();
+  }
+
+  grpc_core::ArenaPromise<grpc_core::ServerMetadataHandle> MakeCallPromise(
+      grpc_core::CallArgs call_args,
+      grpc_core::NextPromiseFactory) override {
+    if (call_args.server_to_client_messages != nullptr) {
+      call_args.server_to_client_messages->Close();
+    }
+    auto* messages = call_args.client_to_server_messages;
+    return grpc_core::Map(
+        grpc_core::Loop([messages]() {
+          return grpc_core::Map(
+              messages->Next(),
+              [](grpc_core::NextResult<grpc_core::MessageHandle> message)
+                  -> grpc_core::LoopCtl<absl::Status> {
+                if (message.has_value()) return grpc_core::Continue{};
+                return absl::OkStatus();
+              });
+        }),
+        [](absl::Status status) {
+          return grpc_core::ServerMetadataFromStatus(status);
+        });
+  }
+};
+
+const grpc_channel_filter UnaryTerminalFilter::kFilter =
+    grpc_core::MakePromiseBasedFilter<UnaryTerminalFilter,
+                                      grpc_core::FilterEndpoint::kClient,
+                                      grpc_core::kFilterIsLast>(
+        "unary_terminal");
+
+}  // namespace unary_terminal_filter
+
+class UnaryTerminalFixture {
+ public:
+  UnaryTerminalFixture() {
+    // See IsolatedCallFixture for why grpc_init() is needed here.
+    grpc_init();
+    grpc_core::ChannelStackBuilderImpl builder(
+        "phony", GRPC_CLIENT_CHANNEL,
+        grpc_core::CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr));
+    builder.SetTarget("phony_target");
+    builder.AppendFilter(
+        &unary_terminal_filter::UnaryTerminalFilter::kFilter);
+    {
+      grpc_core::ExecCtx exec_ctx;
+      channel_ =
+          grpc_core::Channel::CreateWithBuilder(&builder)->release()->c_ptr();
+    }
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+  }
+
+  ~UnaryTerminalFixture() {
+    grpc_completion_queue_destroy(cq_);
+    grpc_channel_destroy(channel_);
+  }
+
+  grpc_channel* channel() const { return channel_; }
+  grpc_completion_queue* cq() const { return cq_; }
+
+ private:
+  grpc_completion_queue* cq_;
+  grpc_channel* channel_;
+};
+
+// The client call implementation a unary call can take.
+enum class UnaryCallPath {
+  kFilterStack,
+  kPromiseBased,
+  kPromiseBasedUnaryFastPath,
+};
+
+// Experiments are process-wide, so each run of this binary only exercises one
+// path: the other registrations skip with the experiments to run them under.
+static const char* SkipReasonForPath(grpc_channel* channel,
+                                     UnaryCallPath path) {
+  UnaryCallPath current = UnaryCallPath::kFilterStack;
+  if (UsesPromiseBasedCalls(channel)) {
+    current = grpc_core::IsPromiseBasedUnaryFastPathEnabled()
+                  ? UnaryCallPath::kPromiseBasedUnaryFastPath
+                  : UnaryCallPath::kPromiseBased;
+  }
+  if (current == path) return nullptr;
+  switch (path) {
+    case UnaryCallPath::kFilterStack:
+      return "run without GRPC_EXPERIMENTS=promise_based_client_call";
+    case UnaryCallPath::kPromiseBased:
+      return "run with GRPC_EXPERIMENTS=promise_based_client_call";
+    case UnaryCallPath::kPromiseBasedUnaryFastPath:
+      return "run with GRPC_EXPERIMENTS=promise_based_client_call,"
+             "promise_based_unary_fast_path";
+  }
+  return nullptr;
+}
+
+static void BM_UnaryCall(benchmark::State& state, UnaryCallPath path) {
+  UnaryTerminalFixture fixture;
+  if (const char* skip_reason = SkipReasonForPath(fixture.channel(), path)) {
+    state.SkipWithError(skip_reason);
+    return;
+  }
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  void* method_hdl = grpc_channel_register_call(fixture.channel(), "/foo/bar",
+                                                nullptr, nullptr);
+  grpc_slice slice = grpc_slice_from_static_string("hello world");
+  grpc_byte_buffer* send_message = grpc_raw_byte_buffer_create(&slice, 1);
+  grpc_byte_buffer* recv_message = nullptr;
+  grpc_status_code status_code;
+  grpc_slice status_details = grpc_empty_slice();
+  grpc_metadata_array recv_initial_metadata;
+  grpc_metadata_array_init(&recv_initial_metadata);
+  grpc_metadata_array recv_trailing_metadata;
+  grpc_metadata_array_init(&recv_trailing_metadata);
+  grpc_op ops[6];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_SEND_MESSAGE;
+  ops[1].data.send_message.send_message = send_message;
+  ops[2].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  ops[3].op = GRPC_OP_RECV_INITIAL_METADATA;
+  ops[3].data.recv_initial_metadata.recv_initial_metadata =
+      &recv_initial_metadata;
+  ops[4].op = GRPC_OP_RECV_MESSAGE;
+  ops[4].data.recv_message.recv_message = &recv_message;
+  ops[5].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[5].data.recv_status_on_client.status = &status_code;
+  ops[5].data.recv_status_on_client.status_details = &status_details;
+  ops[5].data.recv_status_on_client.trailing_metadata = &recv_trailing_metadata;
+  for (auto _ : state) {
+    grpc_call* call = grpc_channel_create_registered_call(
+        fixture.channel(), nullptr, GRPC_PROPAGATE_DEFAULTS, fixture.cq(),
+        method_hdl, deadline, nullptr);
+    GPR_ASSERT(GRPC_CALL_OK ==
+               grpc_call_start_batch(call, ops, 6, tag(1), nullptr));
+    grpc_event ev = grpc_completion_queue_next(
+        fixture.cq(), gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    GPR_ASSERT(ev.success != 0);
+    GPR_ASSERT(status_code == GRPC_STATUS_OK);
+    grpc_call_unref(call);
+    grpc_byte_buffer_destroy(recv_message);
+    recv_message = nullptr;
+    grpc_slice_unref(status_details);
+    status_details = grpc_empty_slice();
+    grpc_metadata_array_destroy(&recv_initial_metadata);
+    grpc_metadata_array_init(&recv_initial_metadata);
+    grpc_metadata_array_destroy(&recv_trailing_metadata);
+    grpc_metadata_array_init(&recv_trailing_metadata);
+  }
+  grpc_metadata_array_destroy(&recv_initial_metadata);
+  grpc_metadata_array_destroy(&recv_trailing_metadata);
+  grpc_byte_buffer_destroy(send_message);
+}
+BENCHMARK_CAPTURE(BM_UnaryCall, filter_stack, UnaryCallPath::kFilterStack);
+BENCHMARK_CAPTURE(BM_UnaryCall, promise_based, UnaryCallPath::kPromiseBased);
+BENCHMARK_CAPTURE(BM_UnaryCall, promise_based_unary_fast_path,
+                  UnaryCallPath::kPromiseBasedUnaryFastPath);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -56,6 +56,9 @@ BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(StreamingPingPongMsgSizeArgs);
+BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InlineInProcess, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(StreamingPingPongMsgSizeArgs);
 
 // Streaming with different message number
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
@@ -64,6 +67,9 @@ BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(StreamingPingPongMsgsNumberArgs);
+BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InlineInProcess, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(StreamingPingPongMsgsNumberArgs);
 
 // Client context with different metadata
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess,
@@ -199,7 +199,9 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
 }
 
-BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
+// Run with and without GRPC_EXPERIMENTS=sharded_completion_queue to compare
+// how throughput scales with the number of threads draining the same queue.
+BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 64)->UseRealTime();
 
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
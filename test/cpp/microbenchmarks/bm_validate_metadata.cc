@@ -0,0 +1,116 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark metadata key/value validation
+
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/surface/validate_metadata.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+// Request and response headers as seen on a typical call.
+const std::pair<const char*, const char*> kHeaders[] = {
+    {"user-agent", "grpc-c++/1.54.0-dev grpc-c/31.0.0 (linux; chttp2)"},
+    {"grpc-accept-encoding", "identity, deflate, gzip"},
+    {"accept-encoding", "identity, gzip"},
+    {"content-type", "application/grpc"},
+    {"te", "trailers"},
+    {"grpc-timeout", "9999870u"},
+    {"authorization",
+     "Bearer ya29.a0AVvZVsoGx3FvQkzq4pTxY2b6Zl5JrX9KcA8wE1MhNfD0uRtLiOyHgBsP"},
+    {"x-request-id", "5e3b1c1a-6a9f-4d5e-9c2b-7f0a3d8e1b42"},
+    {"grpc-status", "0"},
+    {"grpc-message", "OK"},
+};
+
+std::vector<std::pair<grpc_slice, grpc_slice>> MakeHeaderSlices() {
+  std::vector<std::pair<grpc_slice, grpc_slice>> slices;
+  for (const auto& header : kHeaders) {
+    slices.emplace_back(grpc_slice_from_static_string(header.first),
+                        grpc_slice_from_static_string(header.second));
+  }
+  return slices;
+}
+
+void BM_ValidateHeaderKeys(benchmark::State& state) {
+  auto headers = MakeHeaderSlices();
+  for (auto _ : state) {
+    for (const auto& header : headers) {
+      benchmark::DoNotOptimize(
+          grpc_validate_header_key_is_legal(header.first).ok());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * headers.size());
+}
+BENCHMARK(BM_ValidateHeaderKeys);
+
+void BM_ValidateHeaderNonBinValues(benchmark::State& state) {
+  auto headers = MakeHeaderSlices();
+  for (auto _ : state) {
+    for (const auto& header : headers) {
+      benchmark::DoNotOptimize(
+          grpc_validate_header_nonbin_value_is_legal(header.second).ok());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * headers.size());
+}
+BENCHMARK(BM_ValidateHeaderNonBinValues);
+
+// Long values (e.g. JWTs, serialized trace contexts) of the given length.
+void BM_ValidateLongHeaderNonBinValue(benchmark::State& state) {
+  static constexpr char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.";
+  std::vector<char> value(state.range(0));
+  for (size_t i = 0; i < value.size(); i++) {
+    value[i] = kAlphabet[i % (sizeof(kAlphabet) - 1)];
+  }
+  grpc_slice slice = grpc_slice_from_copied_buffer(value.data(), value.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        grpc_validate_header_nonbin_value_is_legal(slice).ok());
+  }
+  state.SetBytesProcessed(state.iterations() * value.size());
+  grpc_slice_unref(slice);
+}
+BENCHMARK(BM_ValidateLongHeaderNonBinValue)->Range(8, 8192);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
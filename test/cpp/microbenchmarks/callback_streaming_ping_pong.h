@@ -81,8 +81,10 @@ class BidiClient : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
   }
 
   void StartNewRpc() {
+    const bool inline_reactors = cli_ctx_->inline_reactors();
     cli_ctx_->~ClientContext();
     new (cli_ctx_) ClientContext();
+    cli_ctx_->set_inline_reactors(inline_reactors);
     cli_ctx_->AddMetadata(kServerMessageSize, std::to_string(msgs_size_));
     stub_->async()->BidiStream(cli_ctx_, this);
     MaybeWrite();
@@ -129,6 +131,7 @@ static void BM_CallbackBidiStreaming(benchmark::State& state) {
   EchoRequest request;
   EchoResponse response;
   ClientContext cli_ctx;
+  cli_ctx.set_inline_reactors(Fixture::kInlineReactors);
   if (message_size > 0) {
     request.set_message(std::string(message_size, 'a'));
   } else {
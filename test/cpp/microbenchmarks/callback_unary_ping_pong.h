@@ -48,8 +48,10 @@ inline void SendCallbackUnaryPingPong(
       [state, cli_ctx, request, response, stub_, done, mu, cv](Status s) {
         GPR_ASSERT(s.ok());
         if (state->KeepRunning()) {
+          const bool inline_reactors = cli_ctx->inline_reactors();
           cli_ctx->~ClientContext();
           new (cli_ctx) ClientContext();
+          cli_ctx->set_inline_reactors(inline_reactors);
           SendCallbackUnaryPingPong(state, cli_ctx, request, response, stub_,
                                     done, mu, cv);
         } else {
@@ -71,6 +73,7 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
   EchoRequest request;
   EchoResponse response;
   ClientContext cli_ctx;
+  cli_ctx.set_inline_reactors(Fixture::kInlineReactors);
 
   if (request_msgs_size > 0) {
     request.set_message(std::string(request_msgs_size, 'a'));
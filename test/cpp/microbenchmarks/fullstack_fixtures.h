@@ -66,6 +66,10 @@ class FixtureConfiguration {
 class BaseFixture {
  public:
   virtual ~BaseFixture() = default;
+
+  // Whether callback reactors on both ends of the fixture run their reactions
+  // inline (see ClientContext::set_inline_reactors).
+  static constexpr bool kInlineReactors = false;
 };
 
 class FullstackFixture : public BaseFixture {
@@ -321,6 +325,27 @@ typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 typedef MinStackize<InProcessCHTTP2> MinInProcessCHTTP2;
 
+////////////////////////////////////////////////////////////////////////////////
+// Inline callback reactor fixtures
+
+class InlineReactorsConfiguration : public FixtureConfiguration {
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->experimental().EnableInlineCallbackReactors();
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class InlineReactorize : public Base {
+ public:
+  explicit InlineReactorize(Service* service)
+      : Base(service, InlineReactorsConfiguration()) {}
+
+  static constexpr bool kInlineReactors = true;
+};
+
+typedef InlineReactorize<InProcess> InlineInProcess;
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -58,21 +58,28 @@ struct TestThreadManagerSettings {
 
   // How many should be instantiated
   int thread_manager_count;
+
+  // If positive, the ThreadManager hands work to its workers through a queue
+  // of this size
+  int max_queued_work;
 };
 
 class TestThreadManager final : public grpc::ThreadManager {
  public:
   TestThreadManager(const char* name, grpc_resource_quota* rq,
                     const TestThreadManagerSettings& settings)
-      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers),
+      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers,
+                      settings.max_queued_work),
         settings_(settings),
         num_do_work_(0),
+        num_rejected_(0),
         num_poll_for_work_(0),
         num_work_found_(0) {}
 
   grpc::ThreadManager::WorkStatus PollForWork(void** tag, bool* ok) override;
-  void DoWork(void* /* tag */, bool /*ok*/, bool /*resources*/) override {
+  void DoWork(void* /* tag */, bool /*ok*/, bool resources) override {
     num_do_work_.fetch_add(1, std::memory_order_relaxed);
+    if (!resources) num_rejected_.fetch_add(1, std::memory_order_relaxed);
 
     // Simulate work by sleeping
     std::this_thread::sleep_for(
@@ -91,12 +98,17 @@ class TestThreadManager final : public grpc::ThreadManager {
   int num_do_work() const {
     return num_do_work_.load(std::memory_order_relaxed);
   }
+  // Get number of times DoWork() was called without resources
+  int num_rejected() const {
+    return num_rejected_.load(std::memory_order_relaxed);
+  }
 
  private:
   TestThreadManagerSettings settings_;
 
   // Counters
   std::atomic_int num_do_work_;        // Number of calls to DoWork
+  std::atomic_int num_rejected_;       // Number of DoWork without resources
   std::atomic_int num_poll_for_work_;  // Number of calls to PollForWork
   std::atomic_int num_work_found_;  // Number of times WORK_FOUND was returned
 };
@@ -155,7 +167,14 @@ TestThreadManagerSettings scenarios[] = {
      INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */},
+    {2 /* min_pollers */, 2 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 50 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     100 /* max_queued_work */},
+    {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
+     2 /* thread_manager_count */, 2 /* max_queued_work */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -179,6 +198,27 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+TEST_P(ThreadManagerTest, TestWorkQueueAdmission) {
+  // Work is only turned away when it cannot be queued or no thread is left to
+  // do it.
+  if (GetParam().max_queued_work >= GetParam().max_poll_calls &&
+      GetParam().thread_limit == INT_MAX) {
+    for (auto& tm : thread_manager_) {
+      EXPECT_EQ(tm->num_rejected(), 0);
+    }
+  } else if (GetParam().max_queued_work > 0 &&
+             GetParam().thread_limit != INT_MAX) {
+    // The pollers take up all but one thread of the quota, so at most one
+    // worker runs across the thread managers, and work that does not fit in
+    // the small queues is turned away.
+    int num_rejected = 0;
+    for (auto& tm : thread_manager_) {
+      num_rejected += tm->num_rejected();
+    }
+    EXPECT_GT(num_rejected, 0);
+  }
+}
+
 }  // namespace
 }  // namespace grpc
 
@@ -1062,6 +1062,7 @@ include/grpcpp/support/proto_buffer_reader.h \
 include/grpcpp/support/proto_buffer_writer.h \
 include/grpcpp/support/server_callback.h \
 include/grpcpp/support/server_interceptor.h \
+include/grpcpp/support/server_unary_batcher.h \
 include/grpcpp/support/slice.h \
 include/grpcpp/support/status.h \
 include/grpcpp/support/status_code_enum.h \